@@ -0,0 +1,140 @@
+#pragma once
+
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <type_traits>
+
+#include <sqlpp17/core/type_traits.h>
+
+namespace sqlpp
+{
+  // Non-owning view of binary data, used for binding and reading blob values without copying.
+  class blob_view
+  {
+    const std::byte* _data = nullptr;
+    std::size_t _size = 0;
+
+  public:
+    using value_type = std::byte;
+    using const_iterator = const std::byte*;
+
+    constexpr blob_view() = default;
+    constexpr blob_view(const std::byte* data, std::size_t size) : _data(data), _size(size)
+    {
+    }
+    blob_view(const void* data, std::size_t size) : _data(static_cast<const std::byte*>(data)), _size(size)
+    {
+    }
+
+    // Contiguous containers of bytes, e.g. std::vector<std::byte>, std::array<unsigned char, N>, or std::string
+    template <typename Container,
+              typename Element = std::remove_pointer_t<decltype(std::data(std::declval<const Container&>()))>,
+              typename = std::enable_if_t<sizeof(Element) == 1 and std::is_trivially_copyable_v<Element> and
+                                          not std::is_same_v<std::decay_t<Container>, blob_view>>>
+    blob_view(const Container& container)
+        : _data(reinterpret_cast<const std::byte*>(std::data(container))), _size(std::size(container))
+    {
+    }
+
+    [[nodiscard]] constexpr auto data() const -> const std::byte*
+    {
+      return _data;
+    }
+
+    [[nodiscard]] constexpr auto size() const -> std::size_t
+    {
+      return _size;
+    }
+
+    [[nodiscard]] constexpr auto empty() const -> bool
+    {
+      return _size == 0;
+    }
+
+    [[nodiscard]] constexpr auto begin() const -> const_iterator
+    {
+      return _data;
+    }
+
+    [[nodiscard]] constexpr auto end() const -> const_iterator
+    {
+      return _data + _size;
+    }
+
+    [[nodiscard]] constexpr auto operator[](std::size_t index) const -> std::byte
+    {
+      return _data[index];
+    }
+
+    [[nodiscard]] friend auto operator==(const blob_view& lhs, const blob_view& rhs) -> bool
+    {
+      if (lhs._size != rhs._size)
+        return false;
+      for (std::size_t i = 0; i < lhs._size; ++i)
+      {
+        if (lhs._data[i] != rhs._data[i])
+          return false;
+      }
+      return true;
+    }
+
+    [[nodiscard]] friend auto operator!=(const blob_view& lhs, const blob_view& rhs) -> bool
+    {
+      return not(lhs == rhs);
+    }
+  };
+
+  template <>
+  constexpr auto is_blob_v<blob_view> = true;
+
+  namespace detail
+  {
+    inline auto append_hex(std::string& target, blob_view blob) -> void
+    {
+      constexpr auto digits = "0123456789ABCDEF";
+      target.reserve(target.size() + 2 * blob.size());
+      for (const auto b : blob)
+      {
+        target.push_back(digits[std::to_integer<unsigned>(b) >> 4]);
+        target.push_back(digits[std::to_integer<unsigned>(b) & 0x0F]);
+      }
+    }
+  }  // namespace detail
+
+  template <typename Context>
+  [[nodiscard]] auto to_sql_string([[maybe_unused]] Context& context, const blob_view& b) -> std::string
+  {
+    auto ret = std::string{"X'"};
+    detail::append_hex(ret, b);
+    ret.push_back('\'');
+    return ret;
+  }
+
+}  // namespace sqlpp
@@ -82,7 +82,7 @@ namespace sqlpp
   template <typename Context, typename Number, typename Statement>
   [[nodiscard]] auto to_sql_string(Context& context, const clause_base<limit_t<Number>, Statement>& t)
   {
-    if (has_value(t._number))
+    if (not has_value(t._number))
       return std::string{};
 
     return std::string(" LIMIT ") + to_sql_string(context, get_value(t._number));
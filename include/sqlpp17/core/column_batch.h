@@ -0,0 +1,268 @@
+#pragma once
+
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include <sqlpp17/core/blob_view.h>
+#include <sqlpp17/core/result_row.h>
+
+namespace sqlpp::detail
+{
+  // Fixed width values, stored contiguously
+  template <typename ValueType>
+  class column_values_t
+  {
+    std::vector<ValueType> _values;
+
+  public:
+    [[nodiscard]] auto size() const -> std::size_t
+    {
+      return _values.size();
+    }
+
+    auto reserve(std::size_t size) -> void
+    {
+      _values.reserve(size);
+    }
+
+    auto clear() -> void
+    {
+      _values.clear();
+    }
+
+    auto push_back(ValueType value) -> void
+    {
+      _values.push_back(value);
+    }
+
+    [[nodiscard]] auto operator[](std::size_t index) const -> ValueType
+    {
+      return _values[index];
+    }
+
+    [[nodiscard]] auto values() const -> const std::vector<ValueType>&
+    {
+      return _values;
+    }
+  };
+
+  // Variable width values, concatenated into one buffer. Value i is bytes()[offsets()[i], offsets()[i + 1]).
+  template <typename ViewType, typename Byte>
+  class variable_width_values_t
+  {
+    std::vector<Byte> _bytes;
+    std::vector<std::size_t> _offsets = {0};
+
+  public:
+    [[nodiscard]] auto size() const -> std::size_t
+    {
+      return _offsets.size() - 1;
+    }
+
+    auto reserve(std::size_t size) -> void
+    {
+      _offsets.reserve(size + 1);
+    }
+
+    auto clear() -> void
+    {
+      _bytes.clear();
+      _offsets.resize(1);
+    }
+
+    auto push_back(ViewType value) -> void
+    {
+      _bytes.insert(_bytes.end(), value.begin(), value.end());
+      _offsets.push_back(_bytes.size());
+    }
+
+    // Valid until the next change of the column
+    [[nodiscard]] auto operator[](std::size_t index) const -> ViewType
+    {
+      return ViewType{_bytes.data() + _offsets[index], _offsets[index + 1] - _offsets[index]};
+    }
+
+    [[nodiscard]] auto bytes() const -> const std::vector<Byte>&
+    {
+      return _bytes;
+    }
+
+    [[nodiscard]] auto offsets() const -> const std::vector<std::size_t>&
+    {
+      return _offsets;
+    }
+  };
+
+  template <>
+  class column_values_t<std::string_view> : public variable_width_values_t<std::string_view, char>
+  {
+  };
+
+  template <>
+  class column_values_t<::sqlpp::blob_view> : public variable_width_values_t<::sqlpp::blob_view, std::byte>
+  {
+  };
+}  // namespace sqlpp::detail
+
+namespace sqlpp
+{
+  // The values of one column of a column_batch_t
+  template <typename ValueType, bool CanBeNull>
+  class batch_column_t : public detail::column_values_t<ValueType>
+  {
+  public:
+    using value_type = ValueType;
+    static constexpr auto can_be_null = CanBeNull;
+
+    [[nodiscard]] constexpr auto is_null([[maybe_unused]] std::size_t index) const -> bool
+    {
+      return false;
+    }
+  };
+
+  // Nullable columns carry a bitmap with one bit per row (set for NULL). NULL rows hold a default value.
+  template <typename ValueType>
+  class batch_column_t<ValueType, true> : public detail::column_values_t<ValueType>
+  {
+    using _base = detail::column_values_t<ValueType>;
+
+    std::vector<std::uint64_t> _null_bitmap;
+
+    auto push_bit(bool is_null) -> void
+    {
+      const auto index = _base::size();
+      if (index % 64 == 0)
+        _null_bitmap.push_back(0);
+      _null_bitmap.back() |= std::uint64_t{is_null} << (index % 64);
+    }
+
+  public:
+    using value_type = ValueType;
+    static constexpr auto can_be_null = true;
+
+    auto reserve(std::size_t size) -> void
+    {
+      _base::reserve(size);
+      _null_bitmap.reserve((size + 63) / 64);
+    }
+
+    auto clear() -> void
+    {
+      _base::clear();
+      _null_bitmap.clear();
+    }
+
+    auto push_back(ValueType value) -> void
+    {
+      push_bit(false);
+      _base::push_back(value);
+    }
+
+    auto push_null() -> void
+    {
+      push_bit(true);
+      _base::push_back(ValueType{});
+    }
+
+    [[nodiscard]] auto is_null(std::size_t index) const -> bool
+    {
+      return (_null_bitmap[index / 64] >> (index % 64)) & 1;
+    }
+
+    [[nodiscard]] auto null_bitmap() const -> const std::vector<std::uint64_t>&
+    {
+      return _null_bitmap;
+    }
+  };
+
+  template <typename ColumnSpec>
+  using batch_column_base =
+      member_t<ColumnSpec, batch_column_t<value_type_of_t<ColumnSpec>, ColumnSpec::can_be_null>>;
+
+  // Rows of a result, stored column by column. Columns are members named like the fields of the result row, e.g.
+  // batch.id[i] and batch.name.is_null(i).
+  template <typename ResultRow>
+  class column_batch_t
+  {
+    static_assert(wrong<ResultRow>, "ResultRow must be a result_row_t<...>");
+  };
+
+  template <typename... ColumnSpecs>
+  class column_batch_t<result_row_t<ColumnSpecs...>> : public batch_column_base<ColumnSpecs>...
+  {
+  public:
+    [[nodiscard]] auto size() const -> std::size_t
+    {
+      return std::min({static_cast<const batch_column_base<ColumnSpecs>&>(*this)().size()...});
+    }
+
+    [[nodiscard]] auto empty() const -> bool
+    {
+      return size() == 0;
+    }
+
+    auto reserve(std::size_t size) -> void
+    {
+      (..., static_cast<batch_column_base<ColumnSpecs>&>(*this)().reserve(size));
+    }
+
+    auto clear() -> void
+    {
+      (..., static_cast<batch_column_base<ColumnSpecs>&>(*this)().clear());
+    }
+  };
+
+  template <typename Column, typename Field>
+  auto append_field(Column& column, const Field& field) -> void
+  {
+    if constexpr (Column::can_be_null)
+    {
+      if (field)
+        column.push_back(*field);
+      else
+        column.push_null();
+    }
+    else
+    {
+      column.push_back(field);
+    }
+  }
+
+  // For backends without a columnar fast path
+  template <typename... ColumnSpecs>
+  auto append_row(column_batch_t<result_row_t<ColumnSpecs...>>& batch, const result_row_t<ColumnSpecs...>& row)
+      -> void
+  {
+    (..., append_field(static_cast<batch_column_base<ColumnSpecs>&>(batch)(),
+                       static_cast<const result_column_base<ColumnSpecs>&>(row)()));
+  }
+}  // namespace sqlpp
@@ -0,0 +1,241 @@
+#pragma once
+
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <sqlpp17/core/result_row.h>
+#include <sqlpp17/core/type_traits.h>
+
+// An alternative layout for result rows: result_row_t stores each nullable field as std::optional, which costs up to
+// one alignment unit per field. compact_row_t stores the values back to back, ordered by decreasing alignment, and
+// keeps the null flags of all nullable columns in one bitmap behind the values.
+
+namespace sqlpp::detail
+{
+  template <std::size_t ColumnCount>
+  struct compact_layout_t
+  {
+    static constexpr auto no_null_bit = ColumnCount;
+
+    std::size_t offsets[ColumnCount] = {};
+    std::size_t null_bits[ColumnCount] = {};
+    std::size_t null_bitmap_offset = 0;
+    std::size_t alignment = 1;
+    std::size_t size = 0;
+  };
+
+  constexpr auto align_up(std::size_t offset, std::size_t alignment) -> std::size_t
+  {
+    return (offset + alignment - 1) / alignment * alignment;
+  }
+
+  template <typename... ColumnSpecs>
+  constexpr auto make_compact_layout()
+  {
+    constexpr auto column_count = sizeof...(ColumnSpecs);
+    constexpr std::size_t sizes[] = {sizeof(value_type_of_t<ColumnSpecs>)...};
+    constexpr std::size_t alignments[] = {alignof(value_type_of_t<ColumnSpecs>)...};
+    constexpr bool nullable[] = {ColumnSpecs::can_be_null...};
+
+    // Stable insertion sort of the column indices by decreasing alignment. With power of two alignments, this
+    // leaves no gaps between the values.
+    std::size_t order[column_count] = {};
+    for (auto i = std::size_t{0}; i < column_count; ++i)
+    {
+      auto k = i;
+      for (; k > 0 and alignments[order[k - 1]] < alignments[i]; --k)
+      {
+        order[k] = order[k - 1];
+      }
+      order[k] = i;
+    }
+
+    auto layout = compact_layout_t<column_count>{};
+    auto offset = std::size_t{0};
+    for (auto k = std::size_t{0}; k < column_count; ++k)
+    {
+      const auto i = order[k];
+      offset = align_up(offset, alignments[i]);
+      layout.offsets[i] = offset;
+      offset += sizes[i];
+      if (alignments[i] > layout.alignment)
+        layout.alignment = alignments[i];
+    }
+
+    auto null_bit_count = std::size_t{0};
+    for (auto i = std::size_t{0}; i < column_count; ++i)
+    {
+      layout.null_bits[i] = nullable[i] ? null_bit_count++ : layout.no_null_bit;
+    }
+
+    layout.null_bitmap_offset = offset;
+    offset += (null_bit_count + 7) / 8;
+    layout.size = align_up(offset > 0 ? offset : 1, layout.alignment);
+    return layout;
+  }
+
+  template <typename... ColumnSpecs>
+  inline constexpr auto compact_layout_v = make_compact_layout<ColumnSpecs...>();
+
+  template <typename NameTag, typename... ColumnSpecs>
+  constexpr auto compact_column_index() -> std::size_t
+  {
+    constexpr bool matches[] = {std::is_same_v<name_tag_of_t<ColumnSpecs>, NameTag>...};
+    for (auto i = std::size_t{0}; i < sizeof...(ColumnSpecs); ++i)
+    {
+      if (matches[i])
+        return i;
+    }
+    return sizeof...(ColumnSpecs);
+  }
+}  // namespace sqlpp::detail
+
+namespace sqlpp
+{
+  template <typename ResultRow>
+  class compact_row_t
+  {
+    static_assert(wrong<ResultRow>, "ResultRow must be a result_row_t<...>");
+  };
+
+  // Fields are read via row(column) or row.get<Index>(). Nullable columns yield std::optional values, the others yield
+  // plain values. Like result_row_t, text and blob fields are views into memory owned elsewhere.
+  template <typename... ColumnSpecs>
+  class compact_row_t<result_row_t<ColumnSpecs...>>
+  {
+    static constexpr const auto& _layout = detail::compact_layout_v<ColumnSpecs...>;
+
+    template <std::size_t Index>
+    using _spec_t = std::tuple_element_t<Index, std::tuple<ColumnSpecs...>>;
+
+    template <std::size_t Index>
+    using _value_t = value_type_of_t<_spec_t<Index>>;
+
+    static_assert((true and ... and std::is_trivially_copyable_v<value_type_of_t<ColumnSpecs>>),
+                  "compact_row_t requires trivially copyable field values");
+
+    alignas(_layout.alignment) std::byte _data[_layout.size] = {};
+
+    template <std::size_t Index>
+    auto set_null(bool is_null) -> void
+    {
+      const auto bit = _layout.null_bits[Index];
+      auto& byte = _data[_layout.null_bitmap_offset + bit / 8];
+      const auto mask = std::byte{static_cast<unsigned char>(1u << (bit % 8))};
+      byte = is_null ? (byte | mask) : (byte & ~mask);
+    }
+
+    template <std::size_t Index, typename Value>
+    auto set_value(const Value& value) -> void
+    {
+      const auto v = _value_t<Index>(value);
+      std::memcpy(_data + _layout.offsets[Index], &v, sizeof(v));
+    }
+
+    template <std::size_t Index, typename Field>
+    auto assign_field(const Field& field) -> void
+    {
+      if constexpr (_spec_t<Index>::can_be_null)
+      {
+        set_null<Index>(not field.has_value());
+        set_value<Index>(field.value_or(_value_t<Index>{}));
+      }
+      else
+      {
+        set_value<Index>(field);
+      }
+    }
+
+    template <std::size_t... Is>
+    auto assign_fields(const result_row_t<ColumnSpecs...>& row, std::index_sequence<Is...>) -> void
+    {
+      (..., assign_field<Is>(static_cast<const result_column_base<ColumnSpecs>&>(row)()));
+    }
+
+  public:
+    compact_row_t() = default;
+
+    compact_row_t(const result_row_t<ColumnSpecs...>& row)
+    {
+      assign(row);
+    }
+
+    auto assign(const result_row_t<ColumnSpecs...>& row) -> void
+    {
+      assign_fields(row, std::index_sequence_for<ColumnSpecs...>{});
+    }
+
+    template <std::size_t Index>
+    [[nodiscard]] auto is_null() const -> bool
+    {
+      if constexpr (_spec_t<Index>::can_be_null)
+      {
+        const auto bit = _layout.null_bits[Index];
+        return static_cast<bool>((_data[_layout.null_bitmap_offset + bit / 8] >> (bit % 8)) & std::byte{1});
+      }
+      else
+      {
+        return false;
+      }
+    }
+
+    template <std::size_t Index>
+    [[nodiscard]] auto get() const
+    {
+      auto value = _value_t<Index>{};
+      std::memcpy(&value, _data + _layout.offsets[Index], sizeof(value));
+      if constexpr (_spec_t<Index>::can_be_null)
+      {
+        return is_null<Index>() ? std::optional<_value_t<Index>>{} : std::optional<_value_t<Index>>{value};
+      }
+      else
+      {
+        return value;
+      }
+    }
+
+    // Takes a column or anything else with the name tag of a selected column, e.g. an alias
+    template <typename Column>
+    [[nodiscard]] auto operator()(const Column&) const
+    {
+      constexpr auto index = detail::compact_column_index<name_tag_of_t<Column>, ColumnSpecs...>();
+      static_assert(index < sizeof...(ColumnSpecs), "compact_row_t: no such column in this row");
+      if constexpr (index < sizeof...(ColumnSpecs))
+        return get<index>();
+    }
+  };
+
+  template <typename... ColumnSpecs>
+  compact_row_t(const result_row_t<ColumnSpecs...>&) -> compact_row_t<result_row_t<ColumnSpecs...>>;
+}  // namespace sqlpp
@@ -27,6 +27,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <sqlpp17/core/bad_expression.h>
+#include <sqlpp17/core/embrace.h>
 #include <sqlpp17/core/to_sql_string.h>
 #include <sqlpp17/core/type_traits.h>
 #include <sqlpp17/core/wrapped_static_assert.h>
@@ -45,6 +45,21 @@ namespace sqlpp
   {
   };
 
+  // Where the database sorts NULL in ascending order, descending order puts it at the other end
+  enum class null_order
+  {
+    first,  // NULL is smaller than any value
+    last,   // NULL is larger than any value
+  };
+
+  // What a pooled connection does with its session before the handle goes back to the pool
+  enum class session_reset
+  {
+    none,   // return the handle as is
+    light,  // roll back open transactions, reset session variables if the backend can do that cheaply
+    full,   // roll back open transactions and discard all session state
+  };
+
   template <typename Pool>
   struct pool_base
   {
@@ -0,0 +1,594 @@
+#pragma once
+
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <sqlpp17/core/connection.h>
+#include <sqlpp17/core/detail/bounded_queue.h>
+#include <sqlpp17/core/exception.h>
+
+namespace sqlpp
+{
+  enum class thread_cache : bool
+  {
+    off,
+    on
+  };
+
+  struct connection_pool_options_t
+  {
+    static constexpr std::size_t default_max_idle = 16;
+
+    std::size_t min_size = 0;  // opened at construction and kept open by idle eviction
+    std::size_t max_size = 0;  // open connections (idle, cached and in use), 0: no limit
+    std::size_t max_idle = 0;  // idle connections in the queue, 0: max_size, or default_max_idle without max_size
+    std::chrono::milliseconds wait_timeout{5000};  // for get() while max_size connections are in use
+    std::chrono::milliseconds idle_ttl{0};         // 0: idle connections do not expire
+    ::sqlpp::thread_cache thread_cache = thread_cache::off;  // not with max_size
+  };
+
+  struct connection_pool_metrics_t
+  {
+    // Upper bounds of the wait time histogram buckets. The last bucket counts longer waits.
+    static constexpr auto wait_bucket_limits =
+        std::array<std::chrono::microseconds, 5>{std::chrono::microseconds{100}, std::chrono::milliseconds{1},
+                                                 std::chrono::milliseconds{10}, std::chrono::milliseconds{100},
+                                                 std::chrono::seconds{1}};
+
+    std::size_t open = 0;
+    std::size_t in_use = 0;
+    std::size_t idle = 0;  // not counting thread caches
+    std::size_t waiting = 0;
+    std::uint64_t creates = 0;
+    std::uint64_t evictions = 0;  // idle connections closed because they expired, were dead or did not fit the queue
+    std::uint64_t timeouts = 0;
+    std::array<std::uint64_t, wait_bucket_limits.size() + 1> wait_histogram = {};
+  };
+}  // namespace sqlpp
+
+namespace sqlpp::detail
+{
+  template <typename Handle>
+  struct idle_handle_t
+  {
+    Handle handle = {};
+    std::chrono::steady_clock::time_point idle_since = {};
+  };
+
+  // Pool ids are never reused, so a handle cached for a pool that has been destroyed is never handed out
+  inline auto next_pool_id() -> std::uint64_t
+  {
+    static auto last_id = std::atomic<std::uint64_t>{0};
+    return ++last_id;
+  }
+
+  // A thread waiting for a connection. It is either handed an idle handle or the right to open a new connection.
+  template <typename Handle>
+  struct pool_waiter_t
+  {
+    std::condition_variable condition;
+    idle_handle_t<Handle> idle = {};
+    bool ready = false;
+  };
+
+  // Shared state of a connection pool. It is kept in a shared_ptr, so that thread caches can return slots of pools
+  // that still exist when their thread ends.
+  template <typename Handle>
+  struct pool_state_t
+  {
+    pool_state_t(std::size_t idle_capacity, std::size_t max) : idle_handles(idle_capacity), max_size(max)
+    {
+    }
+
+    bounded_queue_t<idle_handle_t<Handle>> idle_handles;
+    const std::size_t max_size;
+    std::atomic<std::size_t> open = 0;  // idle, cached and in-use handles
+    std::atomic<std::size_t> in_use = 0;
+    std::atomic<std::uint64_t> creates = 0;
+    std::atomic<std::uint64_t> evictions = 0;
+    std::atomic<std::uint64_t> timeouts = 0;
+    std::array<std::atomic<std::uint64_t>, connection_pool_metrics_t::wait_bucket_limits.size() + 1> wait_histogram =
+        {};
+
+    std::atomic<std::size_t> waiting = 0;
+    std::mutex waiters_mutex;
+    std::deque<pool_waiter_t<Handle>*> waiters;
+
+    auto try_reserve_slot() -> bool
+    {
+      auto current = open.load();
+      do
+      {
+        if (max_size and current >= max_size)
+          return false;
+      } while (not open.compare_exchange_weak(current, current + 1));
+      return true;
+    }
+
+    // Hands an idle handle (or a slot, if the handle is empty) to the longest waiting thread, if any.
+    // waiters_mutex must be locked.
+    auto hand_to_waiter(idle_handle_t<Handle>& idle) -> bool
+    {
+      if (waiters.empty())
+        return false;
+
+      auto* waiter = waiters.front();
+      waiters.pop_front();
+      --waiting;
+      waiter->idle = std::move(idle);
+      waiter->ready = true;
+      waiter->condition.notify_one();
+      return true;
+    }
+
+    // Called when a handle has been closed, allows a waiting thread to open a new connection
+    auto release_slot() -> void
+    {
+      --open;
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (waiting.load() > 0)
+      {
+        const auto lock = std::scoped_lock{waiters_mutex};
+        if (not waiters.empty() and try_reserve_slot())
+        {
+          auto no_handle = idle_handle_t<Handle>{};
+          hand_to_waiter(no_handle);
+        }
+      }
+    }
+
+    auto discard(Handle handle) -> void
+    {
+      handle.reset();
+      ++evictions;
+      release_slot();
+    }
+
+    auto return_idle(idle_handle_t<Handle> idle) -> void
+    {
+      if (waiting.load() > 0)
+      {
+        const auto lock = std::scoped_lock{waiters_mutex};
+        if (hand_to_waiter(idle))
+          return;
+      }
+
+      if (not idle_handles.try_push(idle))
+      {
+        discard(std::move(idle.handle));
+        return;
+      }
+
+      // A thread might have started waiting while the handle was pushed
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (waiting.load() > 0)
+      {
+        const auto lock = std::scoped_lock{waiters_mutex};
+        if (not waiters.empty())
+        {
+          if (auto queued = idle_handles.try_pop())
+          {
+            hand_to_waiter(*queued);
+          }
+        }
+      }
+    }
+  };
+
+  template <typename Handle>
+  struct thread_cached_handle_t
+  {
+    std::uint64_t pool_id = 0;
+    std::weak_ptr<pool_state_t<Handle>> pool_state;  // expired once the pool has been destroyed
+    idle_handle_t<Handle> idle = {};
+
+    ~thread_cached_handle_t()
+    {
+      if (idle.handle)
+      {
+        idle.handle.reset();
+        if (auto state = pool_state.lock())
+        {
+          state->release_slot();
+        }
+      }
+    }
+  };
+
+  template <typename Traits, typename = void>
+  struct can_open_handles : std::false_type
+  {
+  };
+
+  template <typename Traits>
+  struct can_open_handles<Traits,
+                          std::void_t<decltype(Traits::open_handles(std::declval<const typename Traits::config_t&>(),
+                                                                    std::size_t{}))>> : std::true_type
+  {
+  };
+
+  // One slot per thread and handle type, shared by all pools of that type
+  template <typename Handle>
+  auto thread_cached_handle() -> thread_cached_handle_t<Handle>&
+  {
+    thread_local auto cached = thread_cached_handle_t<Handle>{};
+    return cached;
+  }
+}  // namespace sqlpp::detail
+
+namespace sqlpp
+{
+  // Connection pool shared by all backends. Traits provide
+  //  - config_t and handle_t (a unique_ptr to the native connection)
+  //  - template <typename Pool, debug Debug> using connection_t (a connection that returns its handle via put())
+  //  - static auto thread_init() -> void, called before a connection is handed out
+  //  - static auto is_alive(handle_t&) -> bool, used to validate idle handles before reuse
+  //  - optionally static auto open_handles(const config_t&, std::size_t count) -> std::vector<handle_t>, opening
+  //    connections concurrently for prewarm(). The connection constructor has to set up these handles.
+  //
+  // Idle handles are kept in a lock-free queue. With max_size, get() waits in FIFO order for a connection to be
+  // returned once max_size connections are open, and throws after wait_timeout. With thread_cache::on, each thread
+  // keeps the handle it returned last and gets it back first. Cached handles cannot be handed to waiting threads, so
+  // thread_cache::on cannot be combined with max_size.
+  template <typename Traits, ::sqlpp::debug Debug>
+  class connection_pool_t
+  {
+    using _handle_t = typename Traits::handle_t;
+    using _idle_handle_t = detail::idle_handle_t<_handle_t>;
+    using _connection_t = typename Traits::template connection_t<connection_pool_t, Debug>;
+    using _clock = std::chrono::steady_clock;
+    friend _connection_t;
+
+    typename Traits::config_t _connection_config;
+    connection_pool_options_t _options;
+    std::shared_ptr<detail::pool_state_t<_handle_t>> _state;
+    std::uint64_t _id;
+    std::atomic<std::size_t> _prewarming = 0;  // prewarmed connections go to the idle queue, not to a thread cache
+
+  public:
+    using config_t = typename Traits::config_t;
+
+    connection_pool_t() = delete;
+    connection_pool_t(connection_pool_options_t options, typename Traits::config_t connection_config)
+        : _connection_config(std::move(connection_config)),
+          _options(options),
+          _state(std::make_shared<detail::pool_state_t<_handle_t>>(idle_capacity(options), options.max_size)),
+          _id(detail::next_pool_id())
+    {
+      if (_options.max_size and _options.min_size > _options.max_size)
+      {
+        throw sqlpp::exception("Connection pool: min_size must not exceed max_size");
+      }
+      if (_options.max_size and _options.max_idle > _options.max_size)
+      {
+        throw sqlpp::exception("Connection pool: max_idle must not exceed max_size");
+      }
+      if (_options.max_size and _options.thread_cache == thread_cache::on)
+      {
+        throw sqlpp::exception("Connection pool: thread_cache::on cannot be combined with max_size");
+      }
+      if (_options.min_size > _state->idle_handles.capacity())
+      {
+        throw sqlpp::exception("Connection pool: min_size connections must fit into the idle queue");
+      }
+
+      prewarm();
+    }
+    // Keeps up to `capacity` idle connections, without limit on open connections
+    connection_pool_t(std::size_t capacity,
+                      typename Traits::config_t connection_config,
+                      thread_cache cache = thread_cache::off)
+        : connection_pool_t{[&]() {
+                              auto options = connection_pool_options_t{};
+                              options.max_idle = capacity;
+                              options.thread_cache = cache;
+                              return options;
+                            }(),
+                            std::move(connection_config)}
+    {
+    }
+    connection_pool_t(const connection_pool_t&) = delete;
+    connection_pool_t(connection_pool_t&&) = delete;  // connections point to the pool
+    connection_pool_t& operator=(const connection_pool_t&) = delete;
+    connection_pool_t& operator=(connection_pool_t&&) = delete;
+    ~connection_pool_t() = default;
+
+    // Throws sqlpp::exception if no connection becomes available within wait_timeout
+    [[nodiscard]] auto get() -> _connection_t
+    {
+      Traits::thread_init();
+
+      const auto start = _clock::now();
+      auto handle = acquire_handle(start + _options.wait_timeout);
+      record_wait(_clock::now() - start);
+      ++_state->in_use;
+
+      if (handle)
+      {
+        return _connection_t{_connection_config, std::move(handle), this};
+      }
+
+      // A slot has been reserved for a new connection
+      try
+      {
+        auto connection = _connection_t{_connection_config, this};
+        ++_state->creates;
+        return connection;
+      }
+      catch (...)
+      {
+        --_state->in_use;
+        _state->release_slot();
+        throw;
+      }
+    }
+
+    // Opens connections until min_size connections are open, e.g. after a failover closed them. Called by the
+    // constructor.
+    auto prewarm() -> void
+    {
+      const auto open = _state->open.load();
+      const auto count = _options.min_size > open ? _options.min_size - open : std::size_t{0};
+
+      ++_prewarming;
+      struct prewarm_guard_t
+      {
+        std::atomic<std::size_t>& prewarming;
+        ~prewarm_guard_t()
+        {
+          --prewarming;
+        }
+      } const prewarm_guard{_prewarming};
+
+      // Opened connections go to the idle queue when the vector is destroyed (before the guard)
+      auto connections = std::vector<_connection_t>{};
+      connections.reserve(count);
+      if constexpr (detail::can_open_handles<Traits>::value)
+      {
+        for (auto& handle : Traits::open_handles(_connection_config, count))
+        {
+          if (not _state->try_reserve_slot())
+            break;
+
+          try
+          {
+            connections.push_back(_connection_t{_connection_config, std::move(handle), this});
+          }
+          catch (...)
+          {
+            _state->release_slot();
+            throw;
+          }
+          ++_state->in_use;
+          ++_state->creates;
+        }
+      }
+      else
+      {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          connections.push_back(get());
+        }
+      }
+    }
+
+    // Closes idle handles (not those in thread caches) that exceeded idle_ttl, keeping at least min_size connections
+    // open. Idle handles are also checked when they are taken from the pool.
+    auto evict_idle() -> void
+    {
+      const auto now = _clock::now();
+      for (auto count = _state->idle_handles.size(); count > 0; --count)
+      {
+        auto idle = _state->idle_handles.try_pop();
+        if (not idle)
+          break;
+
+        if (is_expired(*idle, now) and _state->open.load() > _options.min_size)
+        {
+          _state->discard(std::move(idle->handle));
+        }
+        else
+        {
+          _state->return_idle(std::move(*idle));
+        }
+      }
+    }
+
+    [[nodiscard]] auto metrics() const -> connection_pool_metrics_t
+    {
+      auto metrics = connection_pool_metrics_t{};
+      metrics.open = _state->open.load();
+      metrics.in_use = _state->in_use.load();
+      metrics.idle = _state->idle_handles.size();
+      metrics.waiting = _state->waiting.load();
+      metrics.creates = _state->creates.load();
+      metrics.evictions = _state->evictions.load();
+      metrics.timeouts = _state->timeouts.load();
+      for (std::size_t i = 0; i < metrics.wait_histogram.size(); ++i)
+      {
+        metrics.wait_histogram[i] = _state->wait_histogram[i].load();
+      }
+      return metrics;
+    }
+
+    [[nodiscard]] auto capacity() const -> std::size_t
+    {
+      return _state->idle_handles.capacity();
+    }
+
+    // Number of idle handles in the queue (not counting thread caches), approximate under concurrent access
+    [[nodiscard]] auto idle_count() const -> std::size_t
+    {
+      return _state->idle_handles.size();
+    }
+
+  private:
+    static auto idle_capacity(const connection_pool_options_t& options) -> std::size_t
+    {
+      if (options.max_idle)
+        return options.max_idle;
+      return options.max_size ? options.max_size : connection_pool_options_t::default_max_idle;
+    }
+
+    // Returns a live idle handle or an empty handle if a slot for a new connection has been reserved
+    auto acquire_handle(_clock::time_point deadline) -> _handle_t
+    {
+      for (;;)
+      {
+        auto idle = take_idle_handle();
+        if (not idle.handle)
+        {
+          if (_state->try_reserve_slot())
+            return {};
+
+          idle = wait_for_handle(deadline);
+          if (not idle.handle)
+            return {};
+        }
+
+        if (not is_expired(idle, _clock::now()) and Traits::is_alive(idle.handle))
+        {
+          return std::move(idle.handle);
+        }
+        _state->discard(std::move(idle.handle));
+      }
+    }
+
+    auto take_idle_handle() -> _idle_handle_t
+    {
+      if (_options.thread_cache == thread_cache::on)
+      {
+        auto& cached = detail::thread_cached_handle<_handle_t>();
+        if (cached.idle.handle and cached.pool_id == _id)
+        {
+          return std::move(cached.idle);
+        }
+      }
+
+      // Threads that are already waiting are served first
+      if (_state->waiting.load() > 0)
+        return {};
+
+      return _state->idle_handles.try_pop().value_or(_idle_handle_t{});
+    }
+
+    auto wait_for_handle(_clock::time_point deadline) -> _idle_handle_t
+    {
+      auto waiter = detail::pool_waiter_t<_handle_t>{};
+      auto lock = std::unique_lock{_state->waiters_mutex};
+      _state->waiters.push_back(&waiter);
+      ++_state->waiting;
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+
+      const auto leave = [this, &waiter]() {
+        _state->waiters.erase(std::find(_state->waiters.begin(), _state->waiters.end(), &waiter));
+        --_state->waiting;
+      };
+
+      // Handles or slots might have been released before this thread was registered
+      if (_state->waiters.front() == &waiter)
+      {
+        if (auto idle = _state->idle_handles.try_pop())
+        {
+          leave();
+          return std::move(*idle);
+        }
+      }
+      if (_state->try_reserve_slot())
+      {
+        leave();
+        return {};
+      }
+
+      if (not waiter.condition.wait_until(lock, deadline, [&waiter]() { return waiter.ready; }))
+      {
+        leave();
+        ++_state->timeouts;
+        throw sqlpp::exception("Connection pool: Timed out waiting for a connection");
+      }
+      return std::move(waiter.idle);
+    }
+
+    auto is_expired(const _idle_handle_t& idle, _clock::time_point now) const -> bool
+    {
+      return _options.idle_ttl.count() > 0 and now - idle.idle_since > _options.idle_ttl;
+    }
+
+    auto record_wait(_clock::duration wait) -> void
+    {
+      const auto& limits = connection_pool_metrics_t::wait_bucket_limits;
+      const auto bucket = std::find_if(limits.begin(), limits.end(), [wait](auto limit) { return wait < limit; });
+      ++_state->wait_histogram[static_cast<std::size_t>(bucket - limits.begin())];
+    }
+
+    // For handles that must not be reused, e.g. because their session could not be reset
+    auto discard(_handle_t handle) -> void
+    {
+      if (not handle)
+        return;
+
+      --_state->in_use;
+      _state->discard(std::move(handle));
+    }
+
+    auto put(_handle_t handle) -> void
+    {
+      if (not handle)
+        return;
+
+      --_state->in_use;
+      auto idle = _idle_handle_t{std::move(handle), _clock::now()};
+
+      if (_options.thread_cache == thread_cache::on and _state->waiting.load() == 0 and _prewarming.load() == 0)
+      {
+        auto& cached = detail::thread_cached_handle<_handle_t>();
+        if (not cached.idle.handle or cached.pool_state.expired())
+        {
+          cached.pool_id = _id;
+          cached.pool_state = _state;
+          cached.idle = std::move(idle);
+          return;
+        }
+      }
+
+      _state->return_idle(std::move(idle));
+    }
+  };
+}  // namespace sqlpp
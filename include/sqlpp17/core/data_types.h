@@ -26,6 +26,7 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <sqlpp17/core/blob_view.h>
 #include <sqlpp17/core/type_traits.h>
 
 namespace sqlpp
@@ -71,4 +72,17 @@ namespace sqlpp
     using type = std::string_view;
   };
 
+  struct blob
+  {
+  };
+
+  template <>
+  constexpr auto is_blob_v<blob> = true;
+
+  template <>
+  struct cpp_type<blob>
+  {
+    using type = ::sqlpp::blob_view;
+  };
+
 }  // namespace sqlpp
@@ -0,0 +1,151 @@
+#pragma once
+
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace sqlpp::detail
+{
+  // Bounded lock-free multi-producer/multi-consumer queue (after Dmitry Vyukov's bounded MPMC queue). Each cell carries
+  // a sequence number that tells producers and consumers whether it is free (2 * position) or filled
+  // (2 * position + 1) for the position they claimed. Doubling keeps both states apart for any capacity.
+  template <typename T>
+  class bounded_queue_t
+  {
+    struct alignas(64) cell_t
+    {
+      std::atomic<std::size_t> sequence = 0;
+      std::optional<T> value;
+    };
+
+    std::unique_ptr<cell_t[]> _cells;
+    std::size_t _capacity;
+    alignas(64) std::atomic<std::size_t> _push_position = 0;
+    alignas(64) std::atomic<std::size_t> _pop_position = 0;
+
+  public:
+    explicit bounded_queue_t(std::size_t capacity) : _cells(std::make_unique<cell_t[]>(capacity)), _capacity(capacity)
+    {
+      for (std::size_t i = 0; i < _capacity; ++i)
+      {
+        _cells[i].sequence.store(2 * i, std::memory_order_relaxed);
+      }
+    }
+
+    [[nodiscard]] auto capacity() const -> std::size_t
+    {
+      return _capacity;
+    }
+
+    // Approximate under concurrent access
+    [[nodiscard]] auto size() const -> std::size_t
+    {
+      const auto pushed = _push_position.load(std::memory_order_relaxed);
+      const auto popped = _pop_position.load(std::memory_order_relaxed);
+      return pushed > popped ? pushed - popped : 0;
+    }
+
+    // Returns false and leaves the value untouched if the queue is full
+    [[nodiscard]] auto try_push(T& value) -> bool
+    {
+      if (_capacity == 0)
+        return false;
+
+      auto position = _push_position.load(std::memory_order_relaxed);
+      for (;;)
+      {
+        auto& cell = _cells[position % _capacity];
+        const auto sequence = cell.sequence.load(std::memory_order_acquire);
+        if (sequence == 2 * position)
+        {
+          if (_push_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+          {
+            cell.value.emplace(std::move(value));
+            cell.sequence.store(2 * position + 1, std::memory_order_release);
+            return true;
+          }
+        }
+        else if (sequence < 2 * position)
+        {
+          return false;  // the cell has not been consumed since the last round: full
+        }
+        else
+        {
+          position = _push_position.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    // Returns nullopt if the queue is empty (or the next value is still being pushed)
+    [[nodiscard]] auto try_pop() -> std::optional<T>
+    {
+      if (_capacity == 0)
+        return std::nullopt;
+
+      auto position = _pop_position.load(std::memory_order_relaxed);
+      for (;;)
+      {
+        auto& cell = _cells[position % _capacity];
+        const auto sequence = cell.sequence.load(std::memory_order_acquire);
+        if (sequence == 2 * position + 1)
+        {
+          if (_pop_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+          {
+            auto value = std::move(cell.value);
+            cell.value.reset();
+            cell.sequence.store(2 * (position + _capacity), std::memory_order_release);
+            return value;
+          }
+        }
+        else if (sequence < 2 * position + 1)
+        {
+          return std::nullopt;  // the cell has not been filled yet: empty
+        }
+        else
+        {
+          position = _pop_position.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    // Number of pushes that have claimed a cell so far
+    [[nodiscard]] auto enqueue_position() const -> std::size_t
+    {
+      return _push_position.load(std::memory_order_acquire);
+    }
+
+    // Number of values popped so far
+    [[nodiscard]] auto dequeue_position() const -> std::size_t
+    {
+      return _pop_position.load(std::memory_order_acquire);
+    }
+  };
+}  // namespace sqlpp::detail
@@ -0,0 +1,209 @@
+#pragma once
+
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+// Parsing of numbers in text format, e.g. PostgreSQL and MySQL text results. The fast paths handle plain decimal
+// numbers (optional sign, digits, for floating point types also a fraction and an exponent). Digits are converted
+// eight at a time within a 64 bit integer (SWAR). Everything else (whitespace, hexadecimal, special values, numbers
+// that cannot be converted exactly) is handed to the C library.
+
+namespace sqlpp::detail
+{
+  inline auto load_eight_chars(const char* chars) -> std::uint64_t
+  {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    auto value = std::uint64_t{};
+    std::memcpy(&value, chars, sizeof(value));
+    return value;
+#else
+    auto value = std::uint64_t{};
+    for (auto i = 0; i < 8; ++i)
+    {
+      value |= std::uint64_t{static_cast<unsigned char>(chars[i])} << (8 * i);
+    }
+    return value;
+#endif
+  }
+
+  // Eight chars in little endian order
+  inline auto are_eight_digits(std::uint64_t chars) -> bool
+  {
+    return ((chars & 0xF0F0F0F0F0F0F0F0) | (((chars + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) ==
+           0x3333333333333333;
+  }
+
+  inline auto parse_eight_digits(std::uint64_t chars) -> std::uint32_t
+  {
+    chars -= 0x3030303030303030;
+    chars = (chars * 10) + (chars >> 8);  // pairs of digits
+    chars = (((chars & 0x000000FF000000FF) * (100 + (1000000ULL << 32))) +
+             (((chars >> 16) & 0x000000FF000000FF) * (1 + (10000ULL << 32)))) >>
+            32;
+    return static_cast<std::uint32_t>(chars);
+  }
+
+  // Accumulates up to max_digits digits into value and returns the number of digits
+  inline auto parse_digits(const char* begin, const char* end, std::uint64_t& value, std::size_t max_digits)
+      -> std::size_t
+  {
+    auto* p = begin;
+    while (end - p >= 8 and static_cast<std::size_t>(p - begin) + 8 <= max_digits)
+    {
+      const auto chars = load_eight_chars(p);
+      if (not are_eight_digits(chars))
+        break;
+      value = value * 100000000 + parse_eight_digits(chars);
+      p += 8;
+    }
+    while (p != end and static_cast<std::size_t>(p - begin) < max_digits and
+           static_cast<unsigned char>(*p - '0') < 10)
+    {
+      value = value * 10 + static_cast<unsigned>(*p - '0');
+      ++p;
+    }
+    return static_cast<std::size_t>(p - begin);
+  }
+
+  // Returns false if the text is not a plain decimal integer in the range of T
+  template <typename T>
+  auto parse_integer_fast(const char* text, std::size_t length, T& value) -> bool
+  {
+    static_assert(std::is_integral_v<T> and std::is_signed_v<T> and sizeof(T) <= 8);
+
+    const auto* p = text;
+    const auto* end = text + length;
+    const auto negative = (p != end and *p == '-');
+    if (p != end and (*p == '-' or *p == '+'))
+      ++p;
+
+    auto magnitude = std::uint64_t{};
+    const auto digits = parse_digits(p, end, magnitude, 19);  // 19 digits never overflow
+    if (digits == 0 or p + digits != end)
+      return false;
+
+    const auto limit = static_cast<std::uint64_t>(std::numeric_limits<T>::max()) + (negative ? 1 : 0);
+    if (magnitude > limit)
+      return false;
+
+    value = negative ? static_cast<T>(0 - magnitude) : static_cast<T>(magnitude);
+    return true;
+  }
+
+  // Clinger's fast path: mantissa and power of ten are exactly representable, so one multiplication or division
+  // rounds correctly. Returns false for anything else.
+  template <typename T>
+  auto parse_floating_point_fast(const char* text, std::size_t length, T& value) -> bool
+  {
+    static_assert(std::is_floating_point_v<T>);
+    constexpr auto max_mantissa = std::uint64_t{1} << std::numeric_limits<T>::digits;
+    constexpr auto max_exponent = std::is_same_v<T, float> ? 10 : 22;
+    constexpr T powers_of_ten[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                   1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+    const auto* p = text;
+    const auto* end = text + length;
+    const auto negative = (p != end and *p == '-');
+    if (p != end and (*p == '-' or *p == '+'))
+      ++p;
+
+    auto mantissa = std::uint64_t{};
+    const auto integer_digits = parse_digits(p, end, mantissa, 19);
+    p += integer_digits;
+    auto fraction_digits = std::size_t{};
+    if (p != end and *p == '.')
+    {
+      ++p;
+      fraction_digits = parse_digits(p, end, mantissa, 19 - integer_digits);
+      p += fraction_digits;
+    }
+    if (integer_digits + fraction_digits == 0)
+      return false;
+
+    auto exponent = -static_cast<int>(fraction_digits);
+    if (p != end and (*p == 'e' or *p == 'E'))
+    {
+      ++p;
+      const auto negative_exponent = (p != end and *p == '-');
+      if (p != end and (*p == '-' or *p == '+'))
+        ++p;
+      auto explicit_exponent = std::uint64_t{};
+      const auto exponent_digits = parse_digits(p, end, explicit_exponent, 4);
+      if (exponent_digits == 0)
+        return false;
+      p += exponent_digits;
+      exponent += negative_exponent ? -static_cast<int>(explicit_exponent) : static_cast<int>(explicit_exponent);
+    }
+
+    // Trailing characters or more than 19 significant digits
+    if (p != end or mantissa > max_mantissa or exponent < -max_exponent or exponent > max_exponent)
+      return false;
+
+    auto result = static_cast<T>(mantissa);
+    result = exponent < 0 ? result / powers_of_ten[-exponent] : result * powers_of_ten[exponent];
+    value = negative ? -result : result;
+    return true;
+  }
+
+  // text must be null terminated, as it is for PQgetvalue() and MYSQL_ROW
+  template <typename T>
+  auto parse_number(const char* text, std::size_t length, T& value) -> void
+  {
+    if constexpr (std::is_integral_v<T>)
+    {
+      if (not parse_integer_fast(text, length, value))
+        value = static_cast<T>(std::strtoll(text, nullptr, 10));
+    }
+    else if constexpr (std::is_same_v<T, float>)
+    {
+      if (not parse_floating_point_fast(text, length, value))
+        value = std::strtof(text, nullptr);
+    }
+    else
+    {
+      if (not parse_floating_point_fast(text, length, value))
+        value = std::strtod(text, nullptr);
+    }
+  }
+
+  // Batch version for a whole column (or a chunk of it), e.g. gathered from a PGresult
+  template <typename T>
+  auto parse_numbers(const char* const* texts, const std::size_t* lengths, std::size_t count, T* values) -> void
+  {
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      parse_number(texts[i], lengths[i], values[i]);
+    }
+  }
+}  // namespace sqlpp::detail
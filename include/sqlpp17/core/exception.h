@@ -27,6 +27,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <stdexcept>
+#include <string>
+#include <utility>
 
 namespace sqlpp
 {
@@ -34,4 +36,66 @@ namespace sqlpp
   {
     using runtime_error::runtime_error;
   };
+
+  // Database independent classification of errors reported by the database
+  enum class error_code
+  {
+    unknown,
+    serialization_failure,  // PostgreSQL 40001
+    deadlock,               // PostgreSQL 40P01, MySQL 1213 (ER_LOCK_DEADLOCK)
+    lock_timeout,           // PostgreSQL 55P03, MySQL 1205 (ER_LOCK_WAIT_TIMEOUT)
+    busy,                   // SQLITE_BUSY
+    locked,                 // SQLITE_LOCKED
+    connection_failure,     // PostgreSQL class 08, 57P01-57P03 and errors raised by libpq, MySQL 2002, 2003, 2006,
+                            // 2013, 2055, SQLITE_CANTOPEN, SQLITE_IOERR, SQLITE_NOTADB
+  };
+
+  // Errors that may go away if the whole transaction is run again (on the same connection)
+  constexpr auto is_retryable(error_code code) -> bool
+  {
+    return code != error_code::unknown and code != error_code::connection_failure;
+  }
+
+  // The connection (or database file) cannot serve statements at the moment
+  constexpr auto is_connection_failure(error_code code) -> bool
+  {
+    return code == error_code::connection_failure;
+  }
+
+  // Thrown for errors reported by the database when executing statements
+  class database_exception : public exception
+  {
+    error_code _code;
+    int _native_code;
+    std::string _sql_state;
+
+  public:
+    database_exception(const std::string& message, error_code code, int native_code, std::string sql_state = {})
+        : exception(message), _code(code), _native_code(native_code), _sql_state(std::move(sql_state))
+    {
+    }
+
+    [[nodiscard]] auto code() const -> error_code
+    {
+      return _code;
+    }
+
+    // The error number of the database, e.g. the MySQL error number or the SQLite result code, 0 for PostgreSQL
+    [[nodiscard]] auto native_code() const -> int
+    {
+      return _native_code;
+    }
+
+    // PostgreSQL only
+    [[nodiscard]] auto sql_state() const -> const std::string&
+    {
+      return _sql_state;
+    }
+  };
+
+  // Thrown if a statement was cancelled, either via a cancel handle or because it exceeded its statement timeout
+  class cancelled_exception : public exception
+  {
+    using exception::exception;
+  };
 }
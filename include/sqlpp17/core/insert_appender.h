@@ -0,0 +1,291 @@
+#pragma once
+
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <sqlpp17/core/clause/insert_into.h>
+#include <sqlpp17/core/detail/bounded_queue.h>
+#include <sqlpp17/core/exception.h>
+
+// Write-behind inserts
+//
+// push() queues a row (a set of assignments) without touching the database. A worker thread owns the connection and
+// inserts the queued rows as multi-row INSERTs of up to max_batch_size rows, at least every flush_interval. If the
+// queue is full, push() blocks until the worker has made room.
+//
+// No row is lost silently: close() (or the destructor) rejects further pushes, inserts everything that has been pushed
+// and returns the final metrics, in which rows_pushed == rows_written + rows_failed. If a batch fails, its rows are
+// inserted one by one and each row that still fails is reported to on_error.
+
+namespace sqlpp
+{
+  struct insert_appender_options_t
+  {
+    std::size_t queue_capacity = 65536;             // rows, at least 1
+    std::size_t max_batch_size = 1000;              // rows per INSERT
+    std::chrono::milliseconds flush_interval{100};  // how long a row may wait in the queue
+    // Called by the worker for each row that could not be inserted. Exceptions thrown by on_error are ignored.
+    std::function<void(std::exception_ptr)> on_error;
+  };
+
+  struct insert_appender_metrics_t
+  {
+    std::uint64_t rows_pushed = 0;
+    std::uint64_t rows_written = 0;
+    std::uint64_t rows_failed = 0;
+    std::uint64_t batches = 0;          // INSERT statements
+    std::uint64_t blocked_pushes = 0;   // pushes that had to wait for room in the queue
+  };
+
+  template <typename Connection, typename Table, typename... Assignments>
+  class insert_appender_t
+  {
+    using _row_t = std::tuple<Assignments...>;
+
+    Connection _connection;  // used by the worker only
+    Table _table;
+    insert_appender_options_t _options;
+    detail::bounded_queue_t<_row_t> _queue;
+    std::size_t _wake_size = 1;  // queued rows that wake the worker
+
+    std::mutex _mutex;
+    std::condition_variable _worker_condition;
+    std::condition_variable _producer_condition;  // blocked pushes and flushes
+    bool _stop = false;
+    std::size_t _flush_position = 0;    // flush() waits for the rows before this queue position
+    std::size_t _written_position = 0;  // rows before this queue position have been handled
+
+    std::atomic<bool> _closed{false};
+    std::atomic<bool> _wake_requested{false};  // set by the push that fills the queue to _wake_size
+    std::atomic<std::size_t> _active_pushes{0};
+    std::atomic<std::uint64_t> _rows_pushed{0};
+    std::atomic<std::uint64_t> _rows_written{0};
+    std::atomic<std::uint64_t> _rows_failed{0};
+    std::atomic<std::uint64_t> _batches{0};
+    std::atomic<std::uint64_t> _blocked_pushes{0};
+
+    std::thread _worker;
+
+    auto queued_rows() const -> std::size_t
+    {
+      return _queue.enqueue_position() - _queue.dequeue_position();
+    }
+
+    auto wake_worker() -> void
+    {
+      // Synchronize with the worker, which might be about to wait
+      {
+        const auto lock = std::scoped_lock{_mutex};
+      }
+      _worker_condition.notify_one();
+    }
+
+    auto insert(const std::vector<_row_t>& rows) -> void
+    {
+      _connection(insert_into(_table).multiset(rows));
+      ++_batches;
+    }
+
+    auto report_error(std::exception_ptr error) -> void
+    {
+      if (not _options.on_error)
+        return;
+
+      try
+      {
+        _options.on_error(std::move(error));
+      }
+      catch (...)
+      {
+        // The worker must keep going, the row has been counted as failed
+      }
+    }
+
+    auto write(std::vector<_row_t>& rows) -> void
+    {
+      if (rows.empty())
+        return;
+
+      try
+      {
+        insert(rows);
+        _rows_written += rows.size();
+      }
+      catch (...)
+      {
+        // Insert the rows one by one to find the failing ones
+        for (auto& row : rows)
+        {
+          try
+          {
+            insert(std::vector<_row_t>{std::move(row)});
+            ++_rows_written;
+          }
+          catch (...)
+          {
+            ++_rows_failed;
+            report_error(std::current_exception());
+          }
+        }
+      }
+      rows.clear();
+    }
+
+    auto run() -> void
+    {
+      auto rows = std::vector<_row_t>{};
+      rows.reserve(_options.max_batch_size);
+      while (true)
+      {
+        auto stop = false;
+        {
+          auto lock = std::unique_lock{_mutex};
+          _worker_condition.wait_for(lock, _options.flush_interval, [this]() {
+            return _stop or _flush_position > _written_position or queued_rows() >= _wake_size;
+          });
+          stop = _stop;
+        }
+        _wake_requested = false;
+
+        while (auto row = _queue.try_pop())
+        {
+          rows.push_back(std::move(*row));
+          if (rows.size() >= _options.max_batch_size)
+            write(rows);
+        }
+        write(rows);
+
+        {
+          const auto lock = std::scoped_lock{_mutex};
+          _written_position = _queue.dequeue_position();
+        }
+        _producer_condition.notify_all();
+
+        // Pushes that started before close() are still accepted
+        if (stop and _active_pushes.load() == 0 and queued_rows() == 0)
+          break;
+      }
+    }
+
+  public:
+    insert_appender_t(Connection connection, Table table, insert_appender_options_t options = {})
+        : _connection(std::move(connection)),
+          _table(table),
+          _options(std::move(options)),
+          _queue(_options.queue_capacity)
+    {
+      if (_options.queue_capacity == 0)
+      {
+        throw sqlpp::exception("Insert appender: queue_capacity must not be 0");
+      }
+      _options.max_batch_size = std::max(_options.max_batch_size, std::size_t{1});
+      _wake_size = std::min(_options.max_batch_size, _queue.capacity());
+      _worker = std::thread{[this]() { run(); }};
+    }
+
+    insert_appender_t(const insert_appender_t&) = delete;
+    insert_appender_t(insert_appender_t&&) = delete;
+    insert_appender_t& operator=(const insert_appender_t&) = delete;
+    insert_appender_t& operator=(insert_appender_t&&) = delete;
+
+    ~insert_appender_t()
+    {
+      close();
+    }
+
+    // Blocks while the queue is full. Throws sqlpp::exception after close().
+    auto push(Assignments... assignments) -> void
+    {
+      ++_active_pushes;
+      if (_closed)
+      {
+        --_active_pushes;
+        throw sqlpp::exception("Insert appender: push() after close()");
+      }
+
+      auto row = _row_t{std::move(assignments)...};
+      if (not _queue.try_push(row))
+      {
+        ++_blocked_pushes;
+        auto lock = std::unique_lock{_mutex};
+        _worker_condition.notify_one();
+        _producer_condition.wait(lock, [this, &row]() { return _queue.try_push(row); });
+      }
+      ++_rows_pushed;
+      const auto queued = queued_rows();
+      --_active_pushes;
+
+      // Concurrent pushes may skip _wake_size, only the first push at or above it wakes the worker
+      if (queued >= _wake_size and not _wake_requested.exchange(true))
+        wake_worker();
+    }
+
+    // Blocks until all rows pushed before the call have been inserted (or reported as failed)
+    auto flush() -> void
+    {
+      const auto position = _queue.enqueue_position();
+      auto lock = std::unique_lock{_mutex};
+      _flush_position = std::max(_flush_position, position);
+      _worker_condition.notify_one();
+      // After close(), the worker's last pass has handled all rows
+      _producer_condition.wait(lock, [this, position]() { return _written_position >= position; });
+    }
+
+    // Inserts all pushed rows and stops the worker
+    auto close() -> insert_appender_metrics_t
+    {
+      if (not _closed.exchange(true))
+      {
+        {
+          const auto lock = std::scoped_lock{_mutex};
+          _stop = true;
+        }
+        _worker_condition.notify_one();
+        _worker.join();
+      }
+      return metrics();
+    }
+
+    [[nodiscard]] auto metrics() const -> insert_appender_metrics_t
+    {
+      return {_rows_pushed, _rows_written, _rows_failed, _batches, _blocked_pushes};
+    }
+  };
+}  // namespace sqlpp
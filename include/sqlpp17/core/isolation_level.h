@@ -26,6 +26,8 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <string_view>
+
 namespace sqlpp
 {
   enum class isolation_level
@@ -36,5 +38,23 @@ namespace sqlpp
     read_committed,   // DMBS holds read locks, non-repeatable reads can occur
     read_uncommitted  // lowest isolation level, dirty reads may occur
   };
+
+  [[nodiscard]] constexpr auto isolation_level_to_sql(isolation_level level) -> std::string_view
+  {
+    switch (level)
+    {
+      case isolation_level::serializable:
+        return "SERIALIZABLE";
+      case isolation_level::repeatable_read:
+        return "REPEATABLE READ";
+      case isolation_level::read_committed:
+        return "READ COMMITTED";
+      case isolation_level::read_uncommitted:
+        return "READ UNCOMMITTED";
+      case isolation_level::current:
+        break;
+    }
+    return "";
+  }
 }
 
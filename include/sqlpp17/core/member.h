@@ -32,4 +32,31 @@ namespace sqlpp
 {
   template <typename MemberSpec, typename Type>
   using member_t = typename name_tag_of_t<MemberSpec>::template _sqlpp_member_base<Type>;
+
+  // Access to members of arbitrary structs, matched by the C++ name of the name tag
+  template <typename MemberSpec, typename Struct, typename Enable = void>
+  struct has_member : std::false_type
+  {
+  };
+
+  template <typename MemberSpec, typename Struct>
+  struct has_member<MemberSpec,
+                    Struct,
+                    std::void_t<decltype(name_tag_of_t<MemberSpec>::_sqlpp_get_member(std::declval<Struct&>()))>>
+      : std::true_type
+  {
+  };
+
+  template <typename MemberSpec, typename Struct>
+  inline constexpr auto has_member_v = has_member<MemberSpec, Struct>::value;
+
+  template <typename MemberSpec, typename Struct>
+  constexpr decltype(auto) get_member(Struct& s)
+  {
+    return name_tag_of_t<MemberSpec>::_sqlpp_get_member(s);
+  }
+
+  template <typename MemberSpec, typename Struct>
+  using member_type_of_t = std::remove_cv_t<std::remove_reference_t<decltype(
+      name_tag_of_t<MemberSpec>::_sqlpp_get_member(std::declval<Struct&>()))>>;
 }
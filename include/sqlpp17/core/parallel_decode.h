@@ -0,0 +1,69 @@
+#pragma once
+
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include <sqlpp17/core/column_batch.h>
+#include <sqlpp17/core/result.h>
+
+namespace sqlpp
+{
+  // Decodes all rows of a fully buffered result (see result_t::decode_columns()) on thread_count threads. Returns one
+  // batch per thread, in row order.
+  template <typename ResultHandle>
+  [[nodiscard]] auto parallel_decode_columns(const result_t<ResultHandle>& result,
+                                             std::size_t thread_count = std::thread::hardware_concurrency())
+      -> std::vector<column_batch_t<typename result_t<ResultHandle>::row_type>>
+  {
+    const auto size = result.size();
+    thread_count = std::clamp(thread_count, std::size_t{1}, std::max(size, std::size_t{1}));
+
+    auto batches = std::vector<column_batch_t<typename result_t<ResultHandle>::row_type>>(thread_count);
+    const auto range_begin = [&](std::size_t i) { return size * i / thread_count; };
+    const auto decode = [&](std::size_t i) {
+      batches[i].reserve(range_begin(i + 1) - range_begin(i));
+      result.decode_columns(range_begin(i), range_begin(i + 1), batches[i]);
+    };
+
+    auto futures = std::vector<std::future<void>>{};
+    for (std::size_t i = 1; i < thread_count; ++i)
+    {
+      futures.push_back(std::async(std::launch::async, decode, i));
+    }
+    decode(0);
+    for (auto& future : futures)
+    {
+      future.get();
+    }
+    return batches;
+  }
+}  // namespace sqlpp
@@ -0,0 +1,246 @@
+#pragma once
+
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory_resource>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <sqlpp17/core/result.h>
+
+// Prefetching results
+//
+// A background thread fetches the rows of a result in batches, so that the I/O of the backend overlaps with the
+// processing of the rows. There are two buffers: while the consumer iterates over one batch, the other one is filled.
+// Text and blob fields are copied into an arena per buffer, so rows are valid until the iteration leaves their
+// batch. The connection of the result must not be used while its prefetching result exists.
+
+namespace sqlpp
+{
+  template <typename Result>
+  class prefetching_result_t
+  {
+    using _row_t = typename Result::row_type;
+
+    struct batch_t
+    {
+      std::vector<_row_t> rows;
+      std::size_t size = 0;
+      bool full = false;  // filled by the producer and not yet released by the consumer
+      bool last = false;
+      std::exception_ptr exception;
+      std::pmr::monotonic_buffer_resource arena;
+    };
+
+    Result _result;  // used by the producer only
+    std::array<batch_t, 2> _batches;
+
+    // Consumer position
+    std::size_t _batch_index = 0;
+    std::size_t _row_index = 0;
+    std::size_t _available_rows = 0;  // rows of the current batch, once it is full
+
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    bool _stop = false;
+    std::thread _producer;
+
+    auto produce() -> void
+    {
+      for (auto index = std::size_t{0};; index = 1 - index)
+      {
+        auto& batch = _batches[index];
+        {
+          auto lock = std::unique_lock{_mutex};
+          _condition.wait(lock, [this, &batch]() { return _stop or not batch.full; });
+          if (_stop)
+            return;
+        }
+
+        // The consumer does not touch the batch until it is full
+        batch.arena.release();
+        try
+        {
+          batch.size = _result.fetch_into(batch.rows.data(), batch.rows.size(), batch.arena);
+          batch.last = batch.size < batch.rows.size();
+        }
+        catch (...)
+        {
+          batch.size = 0;
+          batch.last = true;
+          batch.exception = std::current_exception();
+        }
+
+        {
+          const auto lock = std::scoped_lock{_mutex};
+          batch.full = true;
+        }
+        _condition.notify_all();
+        if (batch.last)
+          return;
+      }
+    }
+
+    // Returns false at the end of the result
+    auto advance_to_row() -> bool
+    {
+      while (_row_index >= _available_rows)
+      {
+        auto& batch = _batches[_batch_index];
+        auto lock = std::unique_lock{_mutex};
+        if (batch.full and _row_index >= batch.size)
+        {
+          if (batch.last)
+          {
+            if (batch.exception)
+              std::rethrow_exception(batch.exception);
+            return false;
+          }
+
+          // Hand the batch back to the producer
+          batch.full = false;
+          lock.unlock();
+          _condition.notify_all();
+          _batch_index = 1 - _batch_index;
+          _row_index = 0;
+          _available_rows = 0;
+          continue;
+        }
+
+        _condition.wait(lock, [&batch]() { return batch.full; });
+        _available_rows = batch.size;
+      }
+      return true;
+    }
+
+  public:
+    using row_type = _row_t;
+
+    prefetching_result_t(Result&& result, std::size_t batch_size) : _result(std::move(result))
+    {
+      for (auto& batch : _batches)
+      {
+        batch.rows.resize(batch_size > 0 ? batch_size : 1);
+      }
+      _producer = std::thread{[this]() { produce(); }};
+    }
+
+    prefetching_result_t(const prefetching_result_t&) = delete;
+    prefetching_result_t(prefetching_result_t&&) = delete;
+    prefetching_result_t& operator=(const prefetching_result_t&) = delete;
+    prefetching_result_t& operator=(prefetching_result_t&&) = delete;
+
+    ~prefetching_result_t()
+    {
+      {
+        const auto lock = std::scoped_lock{_mutex};
+        _stop = true;
+      }
+      _condition.notify_all();
+      _producer.join();
+    }
+
+    class iterator
+    {
+      prefetching_result_t& _result;
+
+    public:
+      using iterator_category = std::input_iterator_tag;
+      using value_type = _row_t;
+      using pointer = const _row_t*;
+      using reference = const _row_t&;
+      using difference_type = std::ptrdiff_t;
+
+      iterator(prefetching_result_t& result) : _result(result)
+      {
+      }
+
+      [[nodiscard]] auto operator*() const -> reference
+      {
+        _result.advance_to_row();
+        return _result._batches[_result._batch_index].rows[_result._row_index];
+      }
+
+      [[nodiscard]] auto operator->() const -> pointer
+      {
+        return &operator*();
+      }
+
+      [[nodiscard]] auto operator==(const iterator& rhs) const -> bool
+      {
+        return false;
+      }
+
+      [[nodiscard]] auto operator==(const result_end_t& rhs) const -> bool
+      {
+        return not _result.advance_to_row();
+      }
+
+      template <typename T>
+      auto operator!=(const T& rhs) const -> bool
+      {
+        return not(operator==(rhs));
+      }
+
+      auto operator++() -> iterator&
+      {
+        ++_result._row_index;
+        return *this;
+      }
+    };
+
+    [[nodiscard]] auto begin() -> iterator
+    {
+      return {*this};
+    }
+
+    [[nodiscard]] constexpr auto end() const -> result_end_t
+    {
+      return {};
+    }
+
+    [[nodiscard]] auto empty() -> bool
+    {
+      return begin() == end();
+    }
+  };
+
+  // Opt-in: prefetch(db(select(...)), 1000)
+  template <typename ResultHandle>
+  [[nodiscard]] auto prefetch(result_t<ResultHandle>&& result, std::size_t batch_size = 1024)
+      -> prefetching_result_t<result_t<ResultHandle>>
+  {
+    return {std::move(result), batch_size};
+  }
+}  // namespace sqlpp
@@ -26,11 +26,75 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <algorithm>
+#include <cstddef>
 #include <iterator>
 #include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <vector>
 
+#include <sqlpp17/core/column_batch.h>
+#include <sqlpp17/core/row_arena.h>
+#include <sqlpp17/core/row_struct.h>
 #include <sqlpp17/core/type_traits.h>
 
+namespace sqlpp::detail
+{
+  template <typename ResultHandle, typename Batch, typename Enable = void>
+  struct has_fetch_columns : std::false_type
+  {
+  };
+
+  template <typename ResultHandle, typename Batch>
+  struct has_fetch_columns<
+      ResultHandle,
+      Batch,
+      std::void_t<decltype(std::declval<ResultHandle&>().fetch_columns(std::declval<Batch&>(), std::size_t{}))>>
+      : std::true_type
+  {
+  };
+
+  template <typename ResultHandle, typename Enable = void>
+  struct has_fetch_into : std::false_type
+  {
+  };
+
+  template <typename ResultHandle>
+  struct has_fetch_into<ResultHandle,
+                        std::void_t<decltype(std::declval<ResultHandle&>().fetch_into(
+                            std::declval<typename ResultHandle::row_type*>(),
+                            std::size_t{},
+                            std::declval<std::pmr::memory_resource&>()))>> : std::true_type
+  {
+  };
+
+  template <typename ResultHandle, typename Struct, typename Enable = void>
+  struct has_get_next_row_into : std::false_type
+  {
+  };
+
+  template <typename ResultHandle, typename Struct>
+  struct has_get_next_row_into<
+      ResultHandle,
+      Struct,
+      std::void_t<decltype(std::declval<ResultHandle&>().get_next_row_into(std::declval<Struct&>()))>>
+      : std::true_type
+  {
+  };
+
+  template <typename ResultHandle, typename Enable = void>
+  struct has_size_hint : std::false_type
+  {
+  };
+
+  template <typename ResultHandle>
+  struct has_size_hint<ResultHandle, std::void_t<decltype(std::declval<const ResultHandle&>().size_hint())>>
+      : std::true_type
+  {
+  };
+}  // namespace sqlpp::detail
+
 namespace sqlpp
 {
   class result_end_t
@@ -44,6 +108,8 @@ namespace sqlpp
     ResultHandle _handle;
 
   public:
+    using row_type = _row_t;
+
     result_t() = default;
 
     result_t(ResultHandle&& handle) : _handle(std::move(handle))
@@ -136,6 +202,150 @@ namespace sqlpp
     {
       ++(begin());
     }
+
+    // Decodes up to max_rows of the remaining rows column by column into batch (which is cleared first). Rows that
+    // have already been visited by an iterator are not included. Returns the number of rows, 0 at the end.
+    auto fetch_columns(column_batch_t<_row_t>& batch, std::size_t max_rows) -> std::size_t
+    {
+      batch.clear();
+      if constexpr (detail::has_fetch_columns<ResultHandle, column_batch_t<_row_t>>::value)
+      {
+        _handle.fetch_columns(batch, max_rows);
+      }
+      else
+      {
+        while (batch.size() < max_rows and _handle)
+        {
+          _handle.get_next_row();
+          if (_handle)
+            append_row(batch, _handle.row());
+        }
+      }
+      return batch.size();
+    }
+
+    [[nodiscard]] auto fetch_columns(std::size_t max_rows) -> column_batch_t<_row_t>
+    {
+      auto batch = column_batch_t<_row_t>{};
+      fetch_columns(batch, max_rows);
+      return batch;
+    }
+
+    // Fills up to count of the remaining rows and returns the number of rows, 0 at the end. Text and blob fields are
+    // copied into arena, so the rows stay valid after the result advances.
+    auto fetch_into(_row_t* rows, std::size_t count, std::pmr::memory_resource& arena) -> std::size_t
+    {
+      if constexpr (detail::has_fetch_into<ResultHandle>::value)
+      {
+        return _handle.fetch_into(rows, count, arena);
+      }
+      else
+      {
+        auto fetched = std::size_t{0};
+        while (fetched < count and _handle)
+        {
+          _handle.get_next_row();
+          if (_handle)
+          {
+            rows[fetched] = _handle.row();
+            copy_fields_to_arena(rows[fetched], arena);
+            ++fetched;
+          }
+        }
+        return fetched;
+      }
+    }
+
+    // For contiguous ranges of rows, e.g. std::vector, std::array or std::span
+    template <typename Rows,
+              typename = std::enable_if_t<std::is_same_v<decltype(std::data(std::declval<Rows&>())), _row_t*>>>
+    auto fetch_into(Rows&& rows, std::pmr::memory_resource& arena) -> std::size_t
+    {
+      return fetch_into(std::data(rows), std::size(rows), arena);
+    }
+
+    // Fetches all remaining rows. Text and blob fields are packed into arena, e.g. a
+    // std::pmr::monotonic_buffer_resource, which allocates one chunk for many fields.
+    [[nodiscard]] auto materialize(std::pmr::memory_resource& arena) -> std::vector<_row_t>
+    {
+      auto rows = std::vector<_row_t>{};
+      if constexpr (detail::has_size_hint<ResultHandle>::value)
+      {
+        // The backend knows an upper bound of the remaining rows
+        if (_handle)
+          rows.resize(_handle.size_hint());
+        rows.resize(fetch_into(rows.data(), rows.size(), arena));
+      }
+      else
+      {
+        auto size = std::size_t{0};
+        while (_handle)
+        {
+          if (size == rows.size())
+          {
+            rows.emplace_back();
+            rows.resize(rows.capacity());
+          }
+          size += fetch_into(rows.data() + size, rows.size() - size, arena);
+        }
+        rows.resize(size);
+      }
+      return rows;
+    }
+
+    // Fully buffered results only (e.g. PostgreSQL): random access to all rows, independent of the iteration
+    // position. See also parallel_decode_columns().
+    template <typename Handle = ResultHandle>
+    [[nodiscard]] auto size() const -> decltype(std::declval<const Handle&>().size())
+    {
+      return _handle.size();
+    }
+
+    template <typename Handle = ResultHandle>
+    [[nodiscard]] auto operator[](std::size_t index) -> decltype(std::declval<Handle&>().row_at(index))
+    {
+      return _handle.row_at(index);
+    }
+
+    // Appends rows [begin, end) to batch. Different ranges may be decoded concurrently.
+    template <typename Handle = ResultHandle>
+    auto decode_columns(std::size_t begin, std::size_t end, column_batch_t<_row_t>& batch) const
+        -> decltype(std::declval<const Handle&>().decode_columns(begin, end, batch))
+    {
+      return _handle.decode_columns(begin, end, batch);
+    }
+
+    // Decodes the remaining rows into structs with members named like the selected columns, see row_struct.h
+    template <typename Struct>
+    [[nodiscard]] auto as() -> std::vector<Struct>
+    {
+      auto structs = std::vector<Struct>{};
+      if constexpr (detail::check_struct_row<Struct, _row_t>::value)  // static_asserts on mismatches
+      {
+        if constexpr (detail::has_size_hint<ResultHandle>::value)
+        {
+          if (_handle)
+            structs.reserve(_handle.size_hint());
+        }
+
+        while (_handle)
+        {
+          if constexpr (detail::has_get_next_row_into<ResultHandle, Struct>::value)
+          {
+            // Without an intermediate result row
+            if (not _handle.get_next_row_into(structs.emplace_back()))
+              structs.pop_back();
+          }
+          else
+          {
+            _handle.get_next_row();
+            if (_handle)
+              detail::assign_members(structs.emplace_back(), _handle.row());
+          }
+        }
+      }
+      return structs;
+    }
   };
 
 }  // namespace sqlpp
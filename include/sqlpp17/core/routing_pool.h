@@ -0,0 +1,358 @@
+#pragma once
+
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <sqlpp17/core/connection_pool.h>
+#include <sqlpp17/core/exception.h>
+#include <sqlpp17/core/result.h>
+#include <sqlpp17/core/statement.h>
+#include <sqlpp17/core/transaction.h>
+
+namespace sqlpp
+{
+  enum class replica_selection
+  {
+    round_robin,
+    least_loaded,  // fewest connections in use
+  };
+
+  struct routing_pool_options_t
+  {
+    replica_selection selection = replica_selection::round_robin;
+    std::chrono::milliseconds read_your_writes{0};        // reads go to the primary this long after a write, 0: off
+    // A replica that failed to hand out a connection or to execute a statement with a connection failure is skipped.
+    // The time doubles with each consecutive failure, up to replica_max_retry_after.
+    std::chrono::milliseconds replica_retry_after{5000};
+    std::chrono::milliseconds replica_max_retry_after{60000};
+  };
+
+  struct replica_status_t
+  {
+    bool healthy = true;
+    std::size_t in_use = 0;
+    std::uint64_t reads = 0;
+    std::uint64_t failures = 0;
+  };
+
+  template <typename Pool>
+  class routing_connection_t;
+
+  // Routes statements to one primary and several replica pools (all of type Pool, e.g.
+  // sqlpp::postgresql::connection_pool_t). Selects outside of transactions go to a healthy replica, everything else
+  // goes to the primary. If no replica is healthy, selects go to the primary, too.
+  template <typename Pool>
+  class routing_pool_t
+  {
+    using _clock = std::chrono::steady_clock;
+    friend routing_connection_t<Pool>;
+
+    struct replica_t
+    {
+      replica_t(const connection_pool_options_t& options, typename Pool::config_t config)
+          : pool{options, std::move(config)}
+      {
+      }
+
+      Pool pool;
+      std::atomic<_clock::rep> down_until = 0;
+      std::atomic<std::uint64_t> reads = 0;
+      std::atomic<std::uint64_t> failures = 0;
+      std::atomic<std::uint32_t> consecutive_failures = 0;
+    };
+
+    routing_pool_options_t _options;
+    Pool _primary;
+    std::vector<std::unique_ptr<replica_t>> _replicas;
+    std::atomic<std::size_t> _next_replica = 0;
+    std::atomic<_clock::rep> _last_write = std::numeric_limits<_clock::rep>::min();
+
+  public:
+    using connection_t = decltype(std::declval<Pool&>().get());
+
+    // Replica pools are opened with the same options as the primary pool, so with min_size > 0, all replicas have to
+    // be reachable at construction.
+    routing_pool_t(routing_pool_options_t options,
+                   const connection_pool_options_t& pool_options,
+                   typename Pool::config_t primary_config,
+                   std::vector<typename Pool::config_t> replica_configs)
+        : _options(options), _primary{pool_options, std::move(primary_config)}
+    {
+      for (auto& config : replica_configs)
+      {
+        _replicas.push_back(std::make_unique<replica_t>(pool_options, std::move(config)));
+      }
+    }
+    routing_pool_t(const routing_pool_t&) = delete;
+    routing_pool_t(routing_pool_t&&) = delete;  // connections point to the pool
+    routing_pool_t& operator=(const routing_pool_t&) = delete;
+    routing_pool_t& operator=(routing_pool_t&&) = delete;
+    ~routing_pool_t() = default;
+
+    [[nodiscard]] auto get() -> routing_connection_t<Pool>
+    {
+      return routing_connection_t<Pool>{*this};
+    }
+
+    [[nodiscard]] auto primary() -> Pool&
+    {
+      return _primary;
+    }
+
+    [[nodiscard]] auto replica(std::size_t index) -> Pool&
+    {
+      return _replicas.at(index)->pool;
+    }
+
+    [[nodiscard]] auto replica_count() const -> std::size_t
+    {
+      return _replicas.size();
+    }
+
+    [[nodiscard]] auto replica_status() const -> std::vector<replica_status_t>
+    {
+      const auto now = _clock::now().time_since_epoch().count();
+      auto status = std::vector<replica_status_t>{};
+      for (const auto& replica : _replicas)
+      {
+        status.push_back({replica->down_until.load() <= now, replica->pool.metrics().in_use, replica->reads.load(),
+                          replica->failures.load()});
+      }
+      return status;
+    }
+
+    // E.g. if monitoring reports too much replication lag. The replica is skipped for replica_retry_after (or longer
+    // after consecutive failures).
+    auto mark_replica_down(std::size_t index) -> void
+    {
+      auto& replica = *_replicas.at(index);
+      ++replica.failures;
+      const auto doublings = std::min<std::uint32_t>(replica.consecutive_failures++, 16);
+      const auto retry_after = std::min(_options.replica_retry_after * (std::int64_t{1} << doublings),
+                                        std::max(_options.replica_max_retry_after, _options.replica_retry_after));
+      replica.down_until = (_clock::now() + retry_after).time_since_epoch().count();
+    }
+
+  private:
+    struct replica_connection_t
+    {
+      std::size_t index;
+      connection_t connection;
+    };
+
+    auto note_write() -> void
+    {
+      if (_options.read_your_writes.count() > 0)
+      {
+        _last_write = _clock::now().time_since_epoch().count();
+      }
+    }
+
+    [[nodiscard]] auto reads_go_to_primary() const -> bool
+    {
+      if (_replicas.empty())
+        return true;
+
+      if (_options.read_your_writes.count() == 0)
+        return false;
+
+      const auto window_end = _last_write.load() + _clock::duration{_options.read_your_writes}.count();
+      return _last_write.load() != std::numeric_limits<_clock::rep>::min() and
+             _clock::now().time_since_epoch().count() < window_end;
+    }
+
+    [[nodiscard]] auto first_replica(_clock::rep now) -> std::size_t
+    {
+      if (_options.selection == replica_selection::round_robin)
+        return _next_replica++ % _replicas.size();
+
+      auto best = std::size_t{0};
+      auto best_in_use = std::numeric_limits<std::size_t>::max();
+      for (std::size_t i = 0; i < _replicas.size(); ++i)
+      {
+        if (_replicas[i]->down_until.load() > now)
+          continue;
+
+        if (const auto in_use = _replicas[i]->pool.metrics().in_use; in_use < best_in_use)
+        {
+          best = i;
+          best_in_use = in_use;
+        }
+      }
+      return best;
+    }
+
+    auto note_replica_success(std::size_t index) -> void
+    {
+      auto& replica = *_replicas[index];
+      if (replica.consecutive_failures.load(std::memory_order_relaxed) > 0)
+        replica.consecutive_failures = 0;
+    }
+
+    // Returns an empty optional if no replica is healthy
+    [[nodiscard]] auto get_replica_connection() -> std::optional<replica_connection_t>
+    {
+      const auto now = _clock::now().time_since_epoch().count();
+      const auto first = first_replica(now);
+      for (std::size_t i = 0; i < _replicas.size(); ++i)
+      {
+        const auto index = (first + i) % _replicas.size();
+        auto& replica = *_replicas[index];
+        if (replica.down_until.load() > now)
+          continue;
+
+        try
+        {
+          auto connection = std::optional<replica_connection_t>{replica_connection_t{index, replica.pool.get()}};
+          ++replica.reads;
+          return connection;
+        }
+        catch (const sqlpp::exception&)
+        {
+          mark_replica_down(index);
+        }
+      }
+      return std::nullopt;
+    }
+  };
+
+  // Takes connections from the primary and a replica when first needed and keeps them until destruction. Results
+  // must not outlive the routing connection.
+  template <typename Pool>
+  class routing_connection_t
+  {
+    using _connection_t = typename routing_pool_t<Pool>::connection_t;
+    using _replica_connection_t = typename routing_pool_t<Pool>::replica_connection_t;
+
+    routing_pool_t<Pool>* _pool;
+    std::optional<_connection_t> _primary;
+    std::optional<_replica_connection_t> _replica;
+    bool _replica_unavailable = false;
+    bool _transaction_active = false;
+
+  public:
+    explicit routing_connection_t(routing_pool_t<Pool>& pool) : _pool(&pool)
+    {
+    }
+
+    template <typename... Clauses>
+    auto operator()(const ::sqlpp::statement<Clauses...>& statement)
+    {
+      using _result_t = decltype(std::declval<_connection_t&>()(statement));
+      if constexpr (std::is_same_v<result_type_of_t<::sqlpp::statement<Clauses...>>, select_result>)
+      {
+        if (not _transaction_active and not _pool->reads_go_to_primary())
+        {
+          // A replica that fails with a connection failure is marked down, the next one is tried
+          while (auto* replica = get_replica())
+          {
+            try
+            {
+              auto result = (*replica)(statement);
+              _pool->note_replica_success(_replica->index);
+              return result;
+            }
+            catch (const ::sqlpp::database_exception& e)
+            {
+              if (not is_connection_failure(e.code()))
+                throw;
+              _pool->mark_replica_down(_replica->index);
+              _replica.reset();
+            }
+          }
+        }
+        return primary()(statement);
+      }
+      else if constexpr (std::is_void_v<_result_t>)
+      {
+        primary()(statement);
+        _pool->note_write();
+      }
+      else
+      {
+        auto result = primary()(statement);
+        _pool->note_write();
+        return result;
+      }
+    }
+
+    auto start_transaction(const transaction_options_t& options = {}) -> void
+    {
+      primary().start_transaction(options);
+      _transaction_active = true;
+    }
+
+    auto commit() -> void
+    {
+      _transaction_active = false;
+      primary().commit();
+      _pool->note_write();
+    }
+
+    auto rollback() -> void
+    {
+      _transaction_active = false;
+      primary().rollback();
+    }
+
+    auto destroy_transaction() noexcept -> void
+    {
+      _transaction_active = false;
+      if (_primary)
+        _primary->destroy_transaction();
+    }
+
+    [[nodiscard]] auto primary() -> _connection_t&
+    {
+      if (not _primary)
+        _primary.emplace(_pool->_primary.get());
+      return *_primary;
+    }
+
+    // Returns nullptr if no replica is healthy
+    [[nodiscard]] auto get_replica() -> _connection_t*
+    {
+      if (not _replica and not _replica_unavailable)
+      {
+        _replica = _pool->get_replica_connection();
+        _replica_unavailable = not _replica;
+      }
+      return _replica ? &_replica->connection : nullptr;
+    }
+  };
+}  // namespace sqlpp
@@ -0,0 +1,87 @@
+#pragma once
+
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <cstring>
+#include <memory_resource>
+#include <optional>
+#include <string_view>
+
+#include <sqlpp17/core/blob_view.h>
+#include <sqlpp17/core/result_row.h>
+
+// Text and blob fields of result rows refer to memory of the backend, which is reused for the next row. Copying
+// their bytes into an arena (any std::pmr::memory_resource, e.g. a std::pmr::monotonic_buffer_resource) makes the
+// rows independent of the result. They remain valid as long as the arena.
+
+namespace sqlpp
+{
+  inline auto copy_to_arena(std::string_view& value, std::pmr::memory_resource& arena) -> void
+  {
+    if (value.empty())
+    {
+      value = {};
+      return;
+    }
+    auto* data = static_cast<char*>(arena.allocate(value.size(), alignof(char)));
+    std::memcpy(data, value.data(), value.size());
+    value = std::string_view{data, value.size()};
+  }
+
+  inline auto copy_to_arena(::sqlpp::blob_view& value, std::pmr::memory_resource& arena) -> void
+  {
+    if (value.empty())
+    {
+      value = {};
+      return;
+    }
+    auto* data = static_cast<std::byte*>(arena.allocate(value.size(), alignof(std::byte)));
+    std::memcpy(data, value.data(), value.size());
+    value = ::sqlpp::blob_view{data, value.size()};
+  }
+
+  template <typename T>
+  auto copy_to_arena(std::optional<T>& value, std::pmr::memory_resource& arena) -> void
+  {
+    if (value)
+    {
+      copy_to_arena(*value, arena);
+    }
+  }
+
+  // Other values do not refer to the result
+  template <typename T>
+  auto copy_to_arena([[maybe_unused]] T& value, [[maybe_unused]] std::pmr::memory_resource& arena) -> void
+  {
+  }
+
+  template <typename... ColumnSpecs>
+  auto copy_fields_to_arena(result_row_t<ColumnSpecs...>& row, std::pmr::memory_resource& arena) -> void
+  {
+    (..., copy_to_arena(static_cast<result_column_base<ColumnSpecs>&>(row)(), arena));
+  }
+}  // namespace sqlpp
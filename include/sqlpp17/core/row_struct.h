@@ -0,0 +1,134 @@
+#pragma once
+
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <sqlpp17/core/blob_view.h>
+#include <sqlpp17/core/member.h>
+#include <sqlpp17/core/result_row.h>
+
+// Decoding rows into user-defined structs, see result_t::as<Struct>(). The members are matched to the selected
+// columns by name. Text and blob values are copied, so text members are std::string and blob members are
+// std::vector<std::byte>. Nullable columns require std::optional members.
+
+namespace sqlpp::detail
+{
+  template <typename ValueType>
+  struct struct_member_type
+  {
+    using type = ValueType;
+  };
+
+  template <>
+  struct struct_member_type<std::string_view>
+  {
+    using type = std::string;
+  };
+
+  template <>
+  struct struct_member_type<::sqlpp::blob_view>
+  {
+    using type = std::vector<std::byte>;
+  };
+
+  template <typename ColumnSpec, typename Member>
+  constexpr auto can_receive_field() -> bool
+  {
+    using expected_t = typename struct_member_type<value_type_of_t<ColumnSpec>>::type;
+    if constexpr (is_optional_v<Member>)
+    {
+      return std::is_same_v<typename Member::value_type, expected_t>;
+    }
+    else
+    {
+      return not ColumnSpec::can_be_null and std::is_same_v<Member, expected_t>;
+    }
+  }
+
+  template <typename Struct, typename ColumnSpec>
+  constexpr auto check_struct_member() -> bool
+  {
+    static_assert(has_member_v<ColumnSpec, Struct>, "as<Struct>(): Struct has no member for a selected column");
+    if constexpr (has_member_v<ColumnSpec, Struct>)
+    {
+      static_assert(can_receive_field<ColumnSpec, member_type_of_t<ColumnSpec, Struct>>(),
+                    "as<Struct>(): member type does not match the selected column (std::string for text, "
+                    "std::vector<std::byte> for blobs, std::optional for nullable columns)");
+      return can_receive_field<ColumnSpec, member_type_of_t<ColumnSpec, Struct>>();
+    }
+    return false;
+  }
+
+  template <typename Struct, typename ResultRow>
+  struct check_struct_row
+  {
+    static_assert(wrong<ResultRow>, "ResultRow must be a result_row_t<...>");
+  };
+
+  template <typename Struct, typename... ColumnSpecs>
+  struct check_struct_row<Struct, result_row_t<ColumnSpecs...>>
+  {
+    static constexpr auto value = (true and ... and check_struct_member<Struct, ColumnSpecs>());
+  };
+
+  template <typename Member, typename Field>
+  auto assign_member(Member& member, const Field& field) -> void
+  {
+    if constexpr (is_optional_v<Field>)
+    {
+      if (field)
+        assign_member(member.emplace(), *field);
+      else
+        member.reset();
+    }
+    else if constexpr (is_optional_v<Member>)
+    {
+      assign_member(member.emplace(), field);
+    }
+    else if constexpr (std::is_same_v<Member, std::vector<std::byte>>)
+    {
+      member.assign(field.begin(), field.end());
+    }
+    else
+    {
+      member = Member(field);
+    }
+  }
+
+  // For backends without a direct path
+  template <typename Struct, typename... ColumnSpecs>
+  auto assign_members(Struct& s, const result_row_t<ColumnSpecs...>& row) -> void
+  {
+    (..., assign_member(get_member<ColumnSpecs>(s), static_cast<const result_column_base<ColumnSpecs>&>(row)()));
+  }
+}  // namespace sqlpp::detail
@@ -0,0 +1,109 @@
+#pragma once
+
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <random>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include <sqlpp17/core/exception.h>
+#include <sqlpp17/core/transaction.h>
+
+namespace sqlpp
+{
+  struct retry_policy_t
+  {
+    std::size_t max_attempts = 5;                   // including the first one
+    std::chrono::milliseconds initial_backoff{10};  // upper bound of the first wait
+    std::chrono::milliseconds max_backoff{1000};    // upper bound of any wait
+    double multiplier = 2.0;                        // growth of the upper bound per attempt
+  };
+}  // namespace sqlpp
+
+namespace sqlpp::detail
+{
+  // Full jitter: a random wait between zero and the exponentially growing bound, which spreads out the retries of
+  // transactions that conflicted with each other
+  inline auto backoff(const retry_policy_t& policy, std::size_t attempt) -> std::chrono::milliseconds
+  {
+    auto bound = static_cast<double>(policy.initial_backoff.count());
+    for (std::size_t i = 1; i < attempt and bound < policy.max_backoff.count(); ++i)
+    {
+      bound *= policy.multiplier;
+    }
+    bound = std::min(bound, static_cast<double>(policy.max_backoff.count()));
+
+    thread_local auto engine = std::mt19937{std::random_device{}()};
+    return std::chrono::milliseconds{
+        static_cast<std::chrono::milliseconds::rep>(std::uniform_real_distribution<double>{0.0, bound}(engine))};
+  }
+}  // namespace sqlpp::detail
+
+namespace sqlpp
+{
+  // Runs function(connection) in a transaction and commits. If the database reports a retryable error (see
+  // is_retryable()), e.g. a serialization failure or deadlock, the transaction is rolled back and the whole function is
+  // run again after a backoff, up to policy.max_attempts times. Other exceptions and the error of the last attempt
+  // are rethrown. The function must therefore be safe to run more than once.
+  template <typename Connection, typename Function>
+  auto run_in_transaction(Connection& connection,
+                          Function&& function,
+                          const retry_policy_t& policy = {},
+                          const transaction_options_t& options = {})
+  {
+    for (std::size_t attempt = 1;; ++attempt)
+    {
+      try
+      {
+        auto transaction = start_transaction(connection, options);
+        if constexpr (std::is_void_v<std::invoke_result_t<Function&, Connection&>>)
+        {
+          function(connection);
+          transaction.commit();
+          return;
+        }
+        else
+        {
+          auto result = function(connection);
+          transaction.commit();
+          return result;
+        }
+      }
+      catch (const database_exception& e)
+      {
+        if (not is_retryable(e.code()) or attempt >= policy.max_attempts)
+          throw;
+      }
+
+      std::this_thread::sleep_for(detail::backoff(policy, attempt));
+    }
+  }
+}  // namespace sqlpp
@@ -0,0 +1,438 @@
+#pragma once
+
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <optional>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <sqlpp17/core/clause/insert_values.h>
+#include <sqlpp17/core/clause/limit.h>
+#include <sqlpp17/core/clause/order_by.h>
+#include <sqlpp17/core/clause/where.h>
+#include <sqlpp17/core/comparison.h>
+#include <sqlpp17/core/connection.h>
+#include <sqlpp17/core/exception.h>
+#include <sqlpp17/core/logical.h>
+#include <sqlpp17/core/member.h>
+#include <sqlpp17/core/operator/asc.h>
+#include <sqlpp17/core/operator/assign.h>
+#include <sqlpp17/core/operator/equal_to.h>
+#include <sqlpp17/core/operator/logical_and.h>
+#include <sqlpp17/core/result.h>
+#include <sqlpp17/core/statement.h>
+
+namespace sqlpp::detail
+{
+  template <typename Clause, typename Statement>
+  auto clause_sort_orders(const Statement& statement)
+  {
+    if constexpr (clause_tag<Clause> == std::string_view{"order_by"})
+      return static_cast<const clause_base<Clause, Statement>&>(statement)._columns;
+    else
+      return std::tuple<>{};
+  }
+
+  // The sort expressions of the order_by clause, if any
+  template <typename... Clauses>
+  auto sort_orders_of(const statement<Clauses...>& statement)
+  {
+    return std::tuple_cat(clause_sort_orders<Clauses>(statement)...);
+  }
+
+  template <typename Clause, typename Statement>
+  auto clause_limit(const Statement& statement) -> std::optional<std::size_t>
+  {
+    if constexpr (clause_tag<Clause> == std::string_view{"limit"})
+    {
+      const auto& number = static_cast<const clause_base<Clause, Statement>&>(statement)._number;
+      if (has_value(number))
+        return static_cast<std::size_t>(get_value(number));
+    }
+    return std::nullopt;
+  }
+
+  template <typename... Clauses>
+  auto limit_of(const statement<Clauses...>& statement) -> std::optional<std::size_t>
+  {
+    auto limit = std::optional<std::size_t>{};
+    (..., (limit = limit ? limit : clause_limit<Clauses>(statement)));
+    return limit;
+  }
+
+  // The shard key of a statement is the value an insert assigns to the key column or the value the where condition
+  // compares the key column to, possibly within ANDs. Finders return a pointer to it or nullptr if there is none.
+  inline auto first_key_operand()
+  {
+    return nullptr;
+  }
+
+  template <typename Operand, typename... Operands>
+  auto first_key_operand(Operand operand, Operands... operands)
+  {
+    if constexpr (std::is_null_pointer_v<Operand>)
+      return first_key_operand(operands...);
+    else
+      return operand;
+  }
+
+  template <typename KeyColumn, typename ShardKey, typename T>
+  auto key_operand_of(const T&)
+  {
+    return nullptr;
+  }
+
+  template <typename KeyColumn, typename ShardKey, typename L, typename R>
+  auto key_operand_of(const comparison_t<L, equal_to_t, R>& t)
+  {
+    if constexpr (std::is_same_v<L, KeyColumn> and std::is_convertible_v<R, ShardKey>)
+      return &t.r;
+    else
+      return nullptr;
+  }
+
+  template <typename KeyColumn, typename ShardKey, typename L, typename R>
+  auto key_operand_of(const assign_t<L, R>& t)
+  {
+    if constexpr (std::is_same_v<L, KeyColumn> and std::is_convertible_v<R, ShardKey>)
+      return &t.value;
+    else
+      return nullptr;
+  }
+
+  template <typename KeyColumn, typename ShardKey, typename L, typename R>
+  auto key_operand_of(const logical_t<L, logical_and_t, R>& t)
+  {
+    return first_key_operand(key_operand_of<KeyColumn, ShardKey>(t._l), key_operand_of<KeyColumn, ShardKey>(t._r));
+  }
+
+  template <typename KeyColumn, typename ShardKey, typename Condition, typename Statement>
+  auto key_operand_of(const clause_base<where_t<Condition>, Statement>& t)
+  {
+    return key_operand_of<KeyColumn, ShardKey>(t._condition);
+  }
+
+  template <typename KeyColumn, typename ShardKey, typename... Assignments, typename Statement>
+  auto key_operand_of(const clause_base<insert_values_t<Assignments...>, Statement>& t)
+  {
+    return std::apply(
+        [](const auto&... assignments) {
+          return first_key_operand(key_operand_of<KeyColumn, ShardKey>(assignments)...);
+        },
+        t._assignments);
+  }
+
+  template <typename KeyColumn, typename ShardKey, typename... Clauses>
+  auto shard_key_operand_of(const statement<Clauses...>& statement)
+  {
+    return first_key_operand(key_operand_of<KeyColumn, ShardKey>(
+        static_cast<const clause_base<Clauses, ::sqlpp::statement<Clauses...>>&>(statement))...);
+  }
+
+  template <typename T>
+  auto compare_values(const T& lhs, const T& rhs, ::sqlpp::null_order null_order) -> int
+  {
+    if constexpr (is_optional_v<T>)
+    {
+      if (not lhs or not rhs)
+      {
+        const auto result = static_cast<int>(lhs.has_value()) - static_cast<int>(rhs.has_value());
+        return null_order == ::sqlpp::null_order::first ? result : -result;
+      }
+      return compare_values(*lhs, *rhs, null_order);
+    }
+    else
+    {
+      return lhs < rhs ? -1 : (rhs < lhs ? 1 : 0);
+    }
+  }
+
+  template <typename Row, typename L>
+  auto compare_rows(const Row& lhs,
+                    const Row& rhs,
+                    const sort_order_t<L>& sort_order,
+                    ::sqlpp::null_order null_order) -> int
+  {
+    static_assert(has_member_v<L, const Row>, "sharded selects can only be ordered by selected columns");
+    const auto result = compare_values(get_member<L>(lhs), get_member<L>(rhs), null_order);
+    return sort_order.order == ::sqlpp::sort_order::desc ? -result : result;
+  }
+
+  template <typename Row, typename... SortOrders>
+  auto row_less(const Row& lhs,
+                const Row& rhs,
+                const std::tuple<SortOrders...>& sort_orders,
+                ::sqlpp::null_order null_order) -> bool
+  {
+    auto result = 0;
+    std::apply(
+        [&](const auto&... sort_order) {
+          (..., (result = result ? result : compare_rows(lhs, rhs, sort_order, null_order)));
+        },
+        sort_orders);
+    return result < 0;
+  }
+
+  // Merges the results of several shards. Rows of ordered results are merged by a streaming k-way merge, unordered
+  // results are concatenated. Stops after `limit` rows. NULL has to be sorted by the shards as by `null_order`.
+  template <typename Result, typename SortOrders>
+  class merged_result_handle_t
+  {
+    std::vector<Result> _results;  // must not be resized, _rows refer to its elements
+    std::vector<typename Result::iterator> _rows;
+    std::vector<std::size_t> _heap;  // results with a current row, the next one is in front
+    SortOrders _sort_orders;
+    ::sqlpp::null_order _null_order;
+    std::optional<std::size_t> _remaining;
+    std::size_t _current = 0;
+    bool _started = false;
+    bool _has_row = false;
+
+    // Heap order: the result whose row comes last is the "largest"
+    auto comes_after(std::size_t lhs, std::size_t rhs) const -> bool
+    {
+      if constexpr (std::tuple_size_v<SortOrders> > 0)
+      {
+        if (row_less(*_rows[rhs], *_rows[lhs], _sort_orders, _null_order))
+          return true;
+        if (row_less(*_rows[lhs], *_rows[rhs], _sort_orders, _null_order))
+          return false;
+      }
+      return lhs > rhs;  // shard order for ties and unordered results
+    }
+
+    auto push(std::size_t index) -> void
+    {
+      if (_rows[index] == _results[index].end())
+        return;
+
+      _heap.push_back(index);
+      std::push_heap(_heap.begin(), _heap.end(), [this](auto lhs, auto rhs) { return comes_after(lhs, rhs); });
+    }
+
+  public:
+    using row_type = typename Result::iterator::value_type;
+
+    // The first row of each result has been fetched already
+    merged_result_handle_t(std::vector<Result> results,
+                           SortOrders sort_orders,
+                           ::sqlpp::null_order null_order,
+                           std::optional<std::size_t> limit)
+        : _results(std::move(results)),
+          _sort_orders(std::move(sort_orders)),
+          _null_order(null_order),
+          _remaining(limit)
+    {
+    }
+    merged_result_handle_t(const merged_result_handle_t&) = delete;
+    merged_result_handle_t(merged_result_handle_t&&) = default;
+    merged_result_handle_t& operator=(const merged_result_handle_t&) = delete;
+    merged_result_handle_t& operator=(merged_result_handle_t&&) = default;
+    ~merged_result_handle_t() = default;
+
+    auto get_next_row() -> void
+    {
+      if (not _started)
+      {
+        _started = true;
+        _rows.reserve(_results.size());
+        for (std::size_t i = 0; i < _results.size(); ++i)
+        {
+          _rows.emplace_back(_results[i]);
+          push(i);
+        }
+      }
+      else if (_has_row)
+      {
+        ++_rows[_current];
+        push(_current);
+      }
+
+      _has_row = not _heap.empty() and _remaining != std::size_t{0};
+      if (not _has_row)
+        return;
+
+      std::pop_heap(_heap.begin(), _heap.end(), [this](auto lhs, auto rhs) { return comes_after(lhs, rhs); });
+      _current = _heap.back();
+      _heap.pop_back();
+      if (_remaining)
+        --*_remaining;
+    }
+
+    [[nodiscard]] auto row() const -> const row_type&
+    {
+      return *_rows[_current];
+    }
+
+    explicit operator bool() const
+    {
+      return _has_row;
+    }
+  };
+}  // namespace sqlpp::detail
+
+namespace sqlpp
+{
+  // Executes statements on horizontally sharded tables. The shard key function maps a key to a shard (modulo the
+  // number of shards). The optional key column lets statements carry their shard key: the value an insert assigns to
+  // it or the value the where condition compares it to with = (possibly within ANDs).
+  //  - db(key, statement) executes a statement on the shard of key, e.g. writes and point reads
+  //  - db(statement) executes a statement with a shard key on the shard of that key
+  //  - db(select) without shard key executes the select on all shards in parallel and merges the results: ordered by
+  //    the statement's order_by (whose expressions have to be selected columns, NULL sorted as by the connector) or
+  //    concatenated in shard order, and limited by its limit (also applied on each shard). Results must not outlive
+  //    the sharded connection.
+  //  - db(statement) without shard key executes other statements on all shards in parallel, e.g. schema changes, and
+  //    sums the numbers of affected rows
+  template <typename Connection, typename ShardKey, typename KeyColumn = void>
+  class sharded_connection_t
+  {
+    std::vector<Connection> _shards;
+    std::function<std::size_t(const ShardKey&)> _shard_of;
+
+    template <typename Statement>
+    auto scatter(const Statement& statement)
+    {
+      using _result_t = decltype(std::declval<Connection&>()(statement));
+      auto futures = std::vector<std::future<_result_t>>{};
+      for (auto& shard : _shards)
+      {
+        futures.push_back(std::async(std::launch::async, [&shard, &statement]() {
+          if constexpr (std::is_same_v<result_type_of_t<Statement>, select_result>)
+          {
+            // Let the shard do the expensive part (e.g. sorting) right away
+            auto result = shard(statement);
+            [[maybe_unused]] const auto first = result.begin();
+            return result;
+          }
+          else
+          {
+            return shard(statement);
+          }
+        }));
+      }
+
+      if constexpr (std::is_void_v<_result_t>)
+      {
+        for (auto& future : futures)
+        {
+          future.get();
+        }
+      }
+      else
+      {
+        auto results = std::vector<_result_t>{};
+        results.reserve(futures.size());
+        for (auto& future : futures)
+        {
+          results.push_back(future.get());
+        }
+        return results;
+      }
+    }
+
+    template <typename... Clauses>
+    auto on_all_shards(const ::sqlpp::statement<Clauses...>& statement)
+    {
+      using _statement_t = ::sqlpp::statement<Clauses...>;
+      using _result_type = result_type_of_t<_statement_t>;
+      static_assert(not std::is_same_v<_result_type, insert_result>, "inserts require a shard key");
+
+      if constexpr (std::is_same_v<_result_type, select_result>)
+      {
+        static_assert((true and ... and (clause_tag<Clauses> != std::string_view{"offset"})),
+                      "selects on all shards cannot have an offset");
+        auto sort_orders = detail::sort_orders_of(statement);
+        using _handle_t = detail::merged_result_handle_t<typename decltype(scatter(statement))::value_type,
+                                                          decltype(sort_orders)>;
+        return ::sqlpp::result_t<_handle_t>{_handle_t{
+            scatter(statement), std::move(sort_orders), Connection::null_order(), detail::limit_of(statement)}};
+      }
+      else if constexpr (std::is_void_v<decltype(std::declval<Connection&>()(statement))>)
+      {
+        scatter(statement);
+      }
+      else
+      {
+        auto affected_rows = decltype(std::declval<Connection&>()(statement)){};
+        for (const auto& count : scatter(statement))
+        {
+          affected_rows += count;
+        }
+        return affected_rows;
+      }
+    }
+
+  public:
+    sharded_connection_t(std::vector<Connection> shards, std::function<std::size_t(const ShardKey&)> shard_of)
+        : _shards(std::move(shards)), _shard_of(std::move(shard_of))
+    {
+      if (_shards.empty())
+      {
+        throw sqlpp::exception("Sharded connection: at least one shard is required");
+      }
+    }
+
+    [[nodiscard]] auto shard_count() const -> std::size_t
+    {
+      return _shards.size();
+    }
+
+    [[nodiscard]] auto shard(std::size_t index) -> Connection&
+    {
+      return _shards.at(index);
+    }
+
+    [[nodiscard]] auto shard_for(const ShardKey& key) -> Connection&
+    {
+      return _shards[_shard_of(key) % _shards.size()];
+    }
+
+    template <typename... Clauses>
+    auto operator()(const ShardKey& key, const ::sqlpp::statement<Clauses...>& statement)
+    {
+      return shard_for(key)(statement);
+    }
+
+    template <typename... Clauses>
+    auto operator()(const ::sqlpp::statement<Clauses...>& statement)
+    {
+      const auto key = detail::shard_key_operand_of<KeyColumn, ShardKey>(statement);
+      if constexpr (std::is_null_pointer_v<decltype(key)>)
+        return on_all_shards(statement);
+      else
+        return shard_for(ShardKey(*key))(statement);
+    }
+  };
+}  // namespace sqlpp
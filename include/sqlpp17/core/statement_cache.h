@@ -0,0 +1,168 @@
+#pragma once
+
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace sqlpp
+{
+  struct statement_cache_stats_t
+  {
+    std::size_t size = 0;
+    std::size_t capacity = 0;
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+  };
+}  // namespace sqlpp
+
+namespace sqlpp::detail
+{
+  // Idle prepared statements of one connection handle, keyed by their SQL text. The cache lives as long as the
+  // handle (pooled connections hand it back to the pool together with the handle), so cached statements never outlive
+  // their handle. StatementHandle is an owning handle, e.g. a unique_ptr that finalizes the statement.
+  template <typename StatementHandle>
+  class statement_cache_ref_t;
+
+  template <typename StatementHandle>
+  class statement_cache_t
+  {
+    std::unordered_multimap<std::string, StatementHandle> _statements;
+    std::size_t _capacity;
+    std::uint64_t _hits = 0;
+    std::uint64_t _misses = 0;
+    // Incremented whenever a connection object gives up the cache, shared with the statements of that connection
+    std::shared_ptr<std::atomic<std::uint64_t>> _owner_generation = std::make_shared<std::atomic<std::uint64_t>>(0);
+
+    friend statement_cache_ref_t<StatementHandle>;
+
+  public:
+    explicit statement_cache_t(std::size_t capacity) : _capacity(capacity)
+    {
+    }
+    statement_cache_t(const statement_cache_t&) = delete;
+    statement_cache_t(statement_cache_t&&) = delete;
+    statement_cache_t& operator=(const statement_cache_t&) = delete;
+    statement_cache_t& operator=(statement_cache_t&&) = delete;
+    ~statement_cache_t()
+    {
+      release_owner();
+    }
+
+    // Called by a connection object before it hands the cache on, e.g. to a pool. Statements it created stop
+    // returning their handles to the cache.
+    auto release_owner() -> void
+    {
+      _owner_generation->fetch_add(1, std::memory_order_release);
+    }
+
+    [[nodiscard]] auto enabled() const -> bool
+    {
+      return _capacity > 0;
+    }
+
+    // Returns an empty handle if no statement with that SQL text is cached
+    [[nodiscard]] auto take(const std::string& sql) -> StatementHandle
+    {
+      const auto it = _statements.find(sql);
+      if (it == _statements.end())
+      {
+        ++_misses;
+        return {};
+      }
+
+      ++_hits;
+      auto statement = std::move(it->second);
+      _statements.erase(it);
+      return statement;
+    }
+
+    // If the cache is full, the statement is destroyed
+    auto put(std::string sql, StatementHandle statement) -> void
+    {
+      if (_statements.size() < _capacity)
+      {
+        _statements.emplace(std::move(sql), std::move(statement));
+      }
+    }
+
+    auto clear() -> void
+    {
+      _statements.clear();
+    }
+
+    // For statements that are already gone on the server side, e.g. after DISCARD ALL
+    auto release_all() -> void
+    {
+      for (auto& entry : _statements)
+      {
+        static_cast<void>(entry.second.release());
+      }
+      _statements.clear();
+    }
+
+    [[nodiscard]] auto stats() const -> statement_cache_stats_t
+    {
+      return {_statements.size(), _capacity, _hits, _misses};
+    }
+  };
+
+  // How prepared statements refer to the cache of the connection object that created them. The cache might be used by
+  // another connection object (and thread) or be gone once that connection object has released it.
+  template <typename StatementHandle>
+  class statement_cache_ref_t
+  {
+    statement_cache_t<StatementHandle>* _cache = nullptr;
+    std::shared_ptr<const std::atomic<std::uint64_t>> _owner_generation;
+    std::uint64_t _generation = 0;
+
+  public:
+    statement_cache_ref_t() = default;
+    explicit statement_cache_ref_t(statement_cache_t<StatementHandle>* cache)
+        : _cache(cache),
+          _owner_generation(cache ? cache->_owner_generation : nullptr),
+          _generation(cache ? cache->_owner_generation->load(std::memory_order_acquire) : 0)
+    {
+    }
+
+    // Returns nullptr once the connection object has released the cache
+    [[nodiscard]] auto get() const -> statement_cache_t<StatementHandle>*
+    {
+      return expired() ? nullptr : _cache;
+    }
+
+    [[nodiscard]] auto expired() const -> bool
+    {
+      return _owner_generation and _owner_generation->load(std::memory_order_acquire) != _generation;
+    }
+  };
+}  // namespace sqlpp::detail
@@ -0,0 +1,70 @@
+#pragma once
+
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <chrono>
+
+namespace sqlpp
+{
+  // Sets the statement timeout of a connection for the lifetime of this object, e.g. for a single statement.
+  // The previous timeout is restored in the destructor.
+  //
+  // Statements that exceed their timeout fail with a sqlpp::cancelled_exception.
+  template <typename Connection>
+  class scoped_statement_timeout
+  {
+    Connection& _connection;
+    std::chrono::milliseconds _previous;
+
+  public:
+    scoped_statement_timeout(Connection& connection, std::chrono::milliseconds timeout)
+        : _connection(connection), _previous(connection.get_statement_timeout())
+    {
+      _connection.set_statement_timeout(timeout);
+    }
+
+    scoped_statement_timeout(const scoped_statement_timeout&) = delete;
+    scoped_statement_timeout(scoped_statement_timeout&&) = delete;
+    scoped_statement_timeout& operator=(const scoped_statement_timeout&) = delete;
+    scoped_statement_timeout& operator=(scoped_statement_timeout&&) = delete;
+
+    ~scoped_statement_timeout()
+    {
+      try
+      {
+        _connection.set_statement_timeout(_previous);
+      }
+      catch (...)
+      {
+        // We must not throw
+      }
+    }
+  };
+
+  template <typename Connection>
+  scoped_statement_timeout(Connection&, std::chrono::milliseconds) -> scoped_statement_timeout<Connection>;
+}  // namespace sqlpp
@@ -31,6 +31,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <optional>
 #include <sstream>
 #include <string>
+#include <type_traits>
 
 #include <sqlpp17/core/exception.h>
 
@@ -68,6 +69,13 @@ namespace sqlpp
     return ret;
   }
 
+  // Exactly std::string, C strings are handled as string_view
+  template <typename Context, typename String, typename = std::enable_if_t<std::is_same_v<String, std::string>>>
+  [[nodiscard]] auto to_sql_string(Context& context, const String& s)
+  {
+    return to_sql_string(context, std::string_view{s});
+  }
+
   template <typename Context, typename T>
   [[nodiscard]] auto to_sql_string(Context& context, const T& i) -> std::enable_if_t<std::is_integral_v<T>, std::string>
   {
@@ -26,8 +26,46 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <optional>
+#include <string>
 #include <utility>
 
+#include <sqlpp17/core/isolation_level.h>
+
+namespace sqlpp
+{
+  // SQLite only: when the transaction acquires its write lock. Immediate and exclusive avoid deadlocks of
+  // transactions that read first and then try to upgrade to a write lock.
+  enum class transaction_lock
+  {
+    deferred,   // with the first write
+    immediate,  // at the start, readers can continue
+    exclusive   // at the start, WAL mode: same as immediate
+  };
+
+  // Options that are not supported by a connector are ignored:
+  //  - PostgreSQL: all but lock
+  //  - MySQL: all but deferrable and lock
+  //  - SQLite: lock and lazy (transactions are always serializable)
+  struct transaction_options_t
+  {
+    isolation_level isolation = isolation_level::current;
+    bool read_only = false;
+    bool deferrable = false;  // serializable read only transactions wait for a safe snapshot instead of risking aborts
+    transaction_lock lock = transaction_lock::deferred;
+    // BEGIN is sent together with the first statement of the transaction instead of a round trip of its own.
+    // Transactions without statements send neither BEGIN nor COMMIT.
+    bool lazy = false;
+  };
+}  // namespace sqlpp
+
+namespace sqlpp::detail
+{
+  // The BEGIN of a lazy transaction that has not been sent yet. Connections keep it on the heap, so that their
+  // prepared statements can refer to it.
+  using pending_begin_t = std::optional<std::string>;
+}  // namespace sqlpp::detail
+
 namespace sqlpp
 {
   template <typename Connection>
@@ -39,9 +77,9 @@ namespace sqlpp
     bool _committed = false;
 
   public:
-    transaction_t(Connection& connection) : _connection(connection)
+    transaction_t(Connection& connection, const transaction_options_t& options = {}) : _connection(connection)
     {
-      _connection.start_transaction();
+      _connection.start_transaction(options);
     }
 
     transaction_t(const transaction_t&) = delete;
@@ -84,9 +122,9 @@ namespace sqlpp
   };
 
   template <typename Connection>
-  auto start_transaction(Connection& connection)
+  auto start_transaction(Connection& connection, const transaction_options_t& options = {})
   {
-    return transaction_t{connection};
+    return transaction_t{connection, options};
   }
 
 }  // namespace sqlpp
@@ -584,6 +584,15 @@ namespace sqlpp
   template <typename T>
   constexpr auto has_text_value_v = is_text_v<remove_optional_t<T>> or is_text_v<remove_optional_t<value_type_of_t<T>>>;
 
+  template <typename T>
+  constexpr auto is_blob_v = false;
+
+  template <>
+  constexpr auto is_blob_v<std::nullopt_t> = true;
+
+  template <typename T>
+  constexpr auto has_blob_value_v = is_blob_v<remove_optional_t<T>> or is_blob_v<remove_optional_t<value_type_of_t<T>>>;
+
   /**
    * @brief Documentation here
    */
@@ -617,6 +626,11 @@ namespace sqlpp
   {
   };
 
+  template <typename L, typename R>
+  struct values_are_compatible<L, R, std::enable_if_t<has_blob_value_v<L> and has_blob_value_v<R>>> : std::true_type
+  {
+  };
+
   template <typename L, typename R>
   inline constexpr auto values_are_compatible_v = values_are_compatible<L, R>::value;
 
@@ -26,17 +26,25 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
 #include <functional>
+#include <memory>
+#include <string>
 #include <type_traits>
 
 #include <sqlpp17/core/connection.h>
 #include <sqlpp17/core/result.h>
 #include <sqlpp17/core/statement.h>
+#include <sqlpp17/core/statement_cache.h>
+#include <sqlpp17/core/transaction.h>
 
 #include <sqlpp17/mysql/clause.h>
 #include <sqlpp17/mysql/connection_config.h>
 #include <sqlpp17/mysql/context.h>
 #include <sqlpp17/mysql/direct_execution_result.h>
+#include <sqlpp17/mysql/exception.h>
 #include <sqlpp17/mysql/mysql.h>
 #include <sqlpp17/mysql/prepared_statement.h>
 #include <sqlpp17/mysql/prepared_statement_result.h>
@@ -49,6 +57,7 @@ namespace sqlpp::mysql
   template <::sqlpp::debug Debug = ::sqlpp::debug::allowed>
   using connection_t = base_connection<no_pool, Debug>;
 
+  class cancel_handle_t;
 };  // namespace sqlpp::mysql
 
 namespace sqlpp::mysql::detail
@@ -66,6 +75,29 @@ namespace sqlpp::mysql::detail
   };
   using unique_connection_ptr = std::unique_ptr<MYSQL, detail::connection_cleanup_t>;
 
+  // What a connection pool keeps per connection: the handle and its prepared statements
+  struct pooled_handle_t
+  {
+    unique_connection_ptr connection;
+    std::unique_ptr<statement_cache_t> statements;  // destroyed before the connection
+
+    explicit operator bool() const
+    {
+      return static_cast<bool>(connection);
+    }
+
+    auto reset() -> void
+    {
+      statements.reset();
+      connection.reset();
+    }
+  };
+
+  __attribute__((no_sanitize("memory"))) inline auto is_alive(MYSQL* handle) -> bool
+  {
+    return mysql_ping(handle) == 0;
+  }
+
   template <typename Pool, ::sqlpp::debug Debug>
   inline auto execute_query(const base_connection<Pool, Debug>& connection, const std::string& query) -> void
   {
@@ -76,11 +108,59 @@ namespace sqlpp::mysql::detail
 
     if (mysql_real_query(connection.get(), query.c_str(), query.size()))
     {
-      throw sqlpp::exception("MySQL: Could not execute query: " + std::string(mysql_error(connection.get())) +
-                             " (query was >>" + query + "<<\n");
+      detail::throw_query_error(mysql_errno(connection.get()), "MySQL: Could not execute query: " +
+                                                                   std::string(mysql_error(connection.get())) +
+                                                                   " (query was >>" + query + "<<\n");
     }
   }
 
+  // Statements of the transaction start, separated by "; "
+  inline auto start_transaction_sql(const ::sqlpp::transaction_options_t& options) -> std::string
+  {
+    auto sql = std::string{};
+    if (options.isolation != ::sqlpp::isolation_level::current)
+    {
+      // Applies to the next transaction only
+      sql = "SET TRANSACTION ISOLATION LEVEL " + std::string(::sqlpp::isolation_level_to_sql(options.isolation)) + "; ";
+    }
+    return sql + (options.read_only ? "START TRANSACTION READ ONLY" : "START TRANSACTION");
+  }
+
+  // Sends the pending BEGIN of a lazy transaction and the query as one multi-statement query and skips to the result
+  // of the query. BEGIN stays pending if it fails.
+  template <typename Pool, ::sqlpp::debug Debug>
+  inline auto execute_after_begin(const base_connection<Pool, Debug>& connection, const std::string& query) -> void
+  {
+    detail::thread_init();
+
+    auto& pending_begin = *connection.get_pending_begin_state();
+    const auto begin_statements = std::count(pending_begin->begin(), pending_begin->end(), ';') + 1;
+    const auto sql = *pending_begin + "; " + query;
+
+    if constexpr (base_connection<Pool, Debug>::is_debug_allowed())
+      connection.debug("Executing: '" + sql + "'");
+
+    // The statements of BEGIN come first, the query is the last one
+    for (auto statement = std::ptrdiff_t{0}; statement <= begin_statements; ++statement)
+    {
+      const auto failed = statement == 0 ? mysql_real_query(connection.get(), sql.c_str(), sql.size()) != 0
+                                         : mysql_next_result(connection.get()) > 0;
+      if (not failed)
+        continue;
+
+      if (statement < begin_statements)
+      {
+        detail::throw_query_error(mysql_errno(connection.get()), "MySQL: Could not begin transaction: " +
+                                                                     std::string(mysql_error(connection.get())) +
+                                                                     " (query was >>" + *pending_begin + "<<\n");
+      }
+      pending_begin.reset();
+      detail::throw_query_error(mysql_errno(connection.get()), "MySQL: Could not execute query: " +
+                                                                   std::string(mysql_error(connection.get())) +
+                                                                   " (query was >>" + query + "<<\n");
+    }
+    pending_begin.reset();
+  }
 }  // namespace sqlpp::mysql::detail
 
 namespace sqlpp::mysql
@@ -98,8 +178,15 @@ namespace sqlpp::mysql
     using _pool_base = ::sqlpp::pool_base<Pool>;
     using _debug_base = ::sqlpp::debug_base<Debug>;
 
+    // Declared before the handle, so it is replaced before the handle during move assignment
+    std::unique_ptr<detail::statement_cache_t> _statement_cache;
     detail::unique_connection_ptr _handle;
+    std::shared_ptr<const connection_config_t> _config;  // for cancel handles
     bool _transaction_active = false;
+    std::chrono::milliseconds _statement_timeout{0};
+    bool _session_dirty = false;  // session variables or objects might have been changed
+    std::unique_ptr<::sqlpp::detail::pending_begin_t> _pending_begin =
+        std::make_unique<::sqlpp::detail::pending_begin_t>();
 
     template <typename... Clauses>
     friend class ::sqlpp::statement;
@@ -109,8 +196,13 @@ namespace sqlpp::mysql
 
     friend Pool;
 
-    base_connection(const connection_config_t& config, detail::unique_connection_ptr&& handle, Pool* connection_pool)
-        : _pool_base{connection_pool}, _debug_base{config.debug}, _handle{std::move(handle)}
+    base_connection(const connection_config_t& config, detail::pooled_handle_t&& handle, Pool* connection_pool)
+        : _pool_base{connection_pool},
+          _debug_base{config.debug},
+          _statement_cache{std::move(handle.statements)},
+          _handle{std::move(handle.connection)},
+          _config{std::shared_ptr<const connection_config_t>{}, &config},  // owned by the pool
+          _statement_timeout{config.statement_timeout}
     {
     }
 
@@ -119,9 +211,52 @@ namespace sqlpp::mysql
       this->_connection_pool = connection_pool;
     }
 
+    // Returns false if the handle must not be reused
+    auto reset_session() noexcept -> bool
+    {
+      const auto policy = _config->reset_on_return;
+      if (policy == ::sqlpp::session_reset::none)
+        return true;
+
+      try
+      {
+        // The transaction status is known locally, clean handles are returned without a round trip
+        const auto in_transaction = (_handle->server_status & SERVER_STATUS_IN_TRANS) != 0;
+
+        if (policy == ::sqlpp::session_reset::full and (_session_dirty or in_transaction))
+        {
+          _statement_cache->clear();  // the reset closes them on the server
+          if (mysql_reset_connection(_handle.get()) != 0)
+            return false;
+
+          if (_config->statement_timeout.count() > 0)
+          {
+            set_statement_timeout(_config->statement_timeout);
+          }
+          if (_config->post_connect)
+          {
+            _config->post_connect(_handle.get());
+          }
+        }
+        else if (in_transaction)
+        {
+          detail::execute_query(*this, "ROLLBACK");
+        }
+        return true;
+      }
+      catch (...)
+      {
+        return false;
+      }
+    }
+
   public:
     base_connection() = delete;
-    base_connection(const connection_config_t& config) : _debug_base{config.debug}, _handle(mysql_init(nullptr))
+    base_connection(const connection_config_t& config)
+        : _debug_base{config.debug},
+          _statement_cache{std::make_unique<detail::statement_cache_t>(config.statement_cache_size)},
+          _handle(mysql_init(nullptr)),
+          _config{std::make_shared<const connection_config_t>(config)}
     {
       if (not _handle)
       {
@@ -159,10 +294,18 @@ namespace sqlpp::mysql
         throw sqlpp::exception("MySQL: can't select database '" + config.database + "'");
       }
 
+      if (config.statement_timeout.count() > 0)
+      {
+        set_statement_timeout(config.statement_timeout);
+      }
+
       if (config.post_connect)
       {
         config.post_connect(_handle.get());
       }
+
+      // The session state set up by the config is the baseline to reset to
+      _session_dirty = false;
     }
 
     base_connection(const base_connection&) = delete;
@@ -173,9 +316,19 @@ namespace sqlpp::mysql
     {
       if constexpr (not std::is_same_v<Pool, no_pool>)
       {
-        if (this->_connection_pool)
-          this->_connection_pool->put(std::move(_handle));
+        if (this->_connection_pool and _handle)
+        {
+          const auto reusable = reset_session();
+          // Statements that outlive this object must not return their handles to the cache from now on
+          _statement_cache->release_owner();
+          auto handle = detail::pooled_handle_t{std::move(_handle), std::move(_statement_cache)};
+          if (reusable)
+            this->_connection_pool->put(std::move(handle));
+          else
+            this->_connection_pool->discard(std::move(handle));
+        }
       }
+      _statement_cache.reset();  // closes statements, requires the handle
     }
 
     template <typename... Clauses>
@@ -203,6 +356,7 @@ namespace sqlpp::mysql
         }
         else if constexpr (std::is_same_v<ResultType, execute_result>)
         {
+          _session_dirty = true;
           return execute(statement);
         }
         else
@@ -222,6 +376,10 @@ namespace sqlpp::mysql
       using Statement = ::sqlpp::statement<Clauses...>;
       if constexpr (constexpr auto _check = check_statement_preparable<base_connection>(type_v<Statement>); _check)
       {
+        if constexpr (std::is_same_v<result_type_of_t<Statement>, execute_result>)
+        {
+          _session_dirty = true;
+        }
         return ::sqlpp::mysql::prepared_statement_t{*this, statement};
       }
       else
@@ -230,14 +388,24 @@ namespace sqlpp::mysql
       }
     }
 
-    auto start_transaction() -> void
+    // options.isolation, options.read_only and options.lazy are supported. Lazy transactions send BEGIN in one
+    // round trip with the first statement if the connection allows multiple statements (CLIENT_MULTI_STATEMENTS).
+    auto start_transaction(const ::sqlpp::transaction_options_t& options = {}) -> void
     {
       if (_transaction_active)
       {
         throw sqlpp::exception("MySQL: Cannot have more than one open transaction per connection");
       }
 
-      detail::execute_query(*this, "START TRANSACTION");
+      if (options.lazy)
+      {
+        *_pending_begin = detail::start_transaction_sql(options);
+      }
+      else
+      {
+        auto pending_begin = ::sqlpp::detail::pending_begin_t{detail::start_transaction_sql(options)};
+        detail::send_pending_begin(get(), pending_begin);
+      }
       _transaction_active = true;
     }
 
@@ -248,6 +416,13 @@ namespace sqlpp::mysql
         throw sqlpp::exception("MySQL: Cannot commit without active transaction");
       }
 
+      if (_pending_begin->has_value())
+      {
+        _pending_begin->reset();  // nothing to commit
+        _transaction_active = false;
+        return;
+      }
+
       _transaction_active = false;
       detail::execute_query(*this, "COMMIT");
     }
@@ -259,6 +434,13 @@ namespace sqlpp::mysql
         throw sqlpp::exception("MySQL: Cannot rollback without active transaction");
       }
 
+      if (_pending_begin->has_value())
+      {
+        _pending_begin->reset();  // nothing to roll back
+        _transaction_active = false;
+        return;
+      }
+
       _transaction_active = false;
       detail::execute_query(*this, "ROLLBACK");
     }
@@ -284,6 +466,11 @@ namespace sqlpp::mysql
       return Debug == ::sqlpp::debug::allowed;
     }
 
+    static constexpr auto null_order()
+    {
+      return ::sqlpp::null_order::first;
+    }
+
     auto debug([[maybe_unused]] const std::string_view message) const
     {
       if constexpr (is_debug_allowed())
@@ -300,14 +487,55 @@ namespace sqlpp::mysql
 
     auto is_alive() -> bool
     {
-      return mysql_ping(_handle.get()) == 0;
+      return detail::is_alive(_handle.get());
     }
 
+    [[nodiscard]] auto get_pending_begin_state() const -> ::sqlpp::detail::pending_begin_t*
+    {
+      return _pending_begin.get();
+    }
+
+    // Statements created by prepare() are taken from and returned to this cache
+    [[nodiscard]] auto get_statement_cache() const -> detail::statement_cache_t*
+    {
+      return _statement_cache.get();
+    }
+
+    [[nodiscard]] auto statement_cache_stats() const -> ::sqlpp::statement_cache_stats_t
+    {
+      return _statement_cache->stats();
+    }
+
+    // SELECT statements that run longer than the timeout fail with a sqlpp::cancelled_exception (MySQL's
+    // max_execution_time does not apply to other statements). 0 means no timeout.
+    auto set_statement_timeout(std::chrono::milliseconds timeout) -> void
+    {
+      detail::execute_query(*this, "SET SESSION max_execution_time = " + std::to_string(timeout.count()));
+      _statement_timeout = timeout;
+      _session_dirty = true;
+    }
+
+    [[nodiscard]] auto get_statement_timeout() const -> std::chrono::milliseconds
+    {
+      return _statement_timeout;
+    }
+
+    [[nodiscard]] auto cancel_handle() const -> cancel_handle_t;
+
   private:
     template <typename... Clauses>
     auto execute(const ::sqlpp::statement<Clauses...>& statement)
     {
-      return detail::execute_query(*this, to_sql_string_c(context_t{}, statement));
+      const auto query = to_sql_string_c(context_t{}, statement);
+      if (_pending_begin->has_value())
+      {
+        if (_config->client_flag & CLIENT_MULTI_STATEMENTS)
+        {
+          return detail::execute_after_begin(*this, query);
+        }
+        detail::send_pending_begin(get(), *_pending_begin);
+      }
+      return detail::execute_query(*this, query);
     }
 
     template <typename Statement>
@@ -339,7 +567,8 @@ namespace sqlpp::mysql
       auto result_handle = detail::unique_result_ptr(mysql_store_result(this->get()), {});
       if (!result_handle)
       {
-        throw sqlpp::exception("MySQL: Could not store result set: " + std::string(mysql_error(this->get())));
+        detail::throw_query_error(mysql_errno(this->get()),
+                                  "MySQL: Could not store result set: " + std::string(mysql_error(this->get())));
       }
 
       using _result_type = direct_execution_result_t<result_row_of_t<Statement>>;
@@ -347,4 +576,44 @@ namespace sqlpp::mysql
     }
   };
 
+  // Allows to cancel the statement that is currently executed by a connection, e.g. from another thread.
+  // Cancelling opens a separate connection to send KILL QUERY. The handle stays valid after the connection has been
+  // closed, but must not be used once the server might have reused the connection id.
+  class cancel_handle_t
+  {
+    connection_config_t _config;
+    unsigned long _thread_id;
+
+  public:
+    cancel_handle_t(connection_config_t config, unsigned long thread_id)
+        : _config(std::move(config)), _thread_id(thread_id)
+    {
+      _config.statement_timeout = std::chrono::milliseconds{0};
+      _config.pre_connect = nullptr;
+      _config.post_connect = nullptr;
+    }
+
+    // Requests cancellation of the running statement, which then fails with a sqlpp::cancelled_exception.
+    // Returns false if the request could not be sent.
+    auto cancel() const -> bool
+    {
+      try
+      {
+        auto connection = connection_t<::sqlpp::debug::none>{_config};
+        detail::execute_query(connection, "KILL QUERY " + std::to_string(_thread_id));
+        return true;
+      }
+      catch (const sqlpp::exception&)
+      {
+        return false;
+      }
+    }
+  };
+
+  template <typename Pool, ::sqlpp::debug Debug>
+  auto base_connection<Pool, Debug>::cancel_handle() const -> cancel_handle_t
+  {
+    return cancel_handle_t{*_config, mysql_thread_id(_handle.get())};
+  }
+
 }  // namespace sqlpp::mysql
@@ -26,8 +26,10 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <chrono>
 #include <optional>
 
+#include <sqlpp17/core/connection.h>
 #include <sqlpp17/mysql/mysql.h>
 
 namespace sqlpp::mysql
@@ -54,6 +56,11 @@ namespace sqlpp::mysql
     unsigned long client_flag = 0;
     std::string database;
     std::string charset = "utf8";
+    std::chrono::milliseconds statement_timeout{0};  // 0: no timeout
+    std::size_t statement_cache_size = 32;           // statements kept by connection.prepare(), 0: no cache
+    // Pooled connections only. light: roll back open transactions, full: mysql_reset_connection(). After a full
+    // reset, the statement timeout and post_connect are applied again.
+    ::sqlpp::session_reset reset_on_return = ::sqlpp::session_reset::full;
     std::function<void(std::string_view)> debug;
 
     connection_config_t() = default;
@@ -26,63 +26,27 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
-#include <mutex>
-
+#include <sqlpp17/core/connection_pool.h>
 #include <sqlpp17/mysql/connection.h>
 
 namespace sqlpp::mysql::detail
 {
-  class circular_connection_buffer_t
+  struct pool_traits
   {
-    std::vector<detail::unique_connection_ptr> _data;
-    std::size_t _head = 0;
-    std::size_t _tail = 0;
-    std::size_t _size = 0;
-
-    auto increment(std::size_t& pos)
-    {
-      ++pos;
-      if (pos == _data.size())
-        pos = 0;
-    }
-
-  public:
-    circular_connection_buffer_t(std::size_t capacity) : _data(capacity)
-    {
-    }
-
-    [[nodiscard]] auto empty() const
-    {
-      return _size == 0;
-    }
+    using config_t = connection_config_t;
+    using handle_t = pooled_handle_t;
 
-    [[nodiscard]] auto& front()
-    {
-      return _data[_tail];
-    }
+    template <typename Pool, ::sqlpp::debug Debug>
+    using connection_t = base_connection<Pool, Debug>;
 
-    auto pop_front() -> void
+    static auto thread_init() -> void
     {
-      if ((_head != _tail) or not empty())
-      {
-        increment(_tail);
-        --_size;
-      }
+      detail::thread_init();
     }
 
-    auto push_back(detail::unique_connection_ptr t)
+    static auto is_alive(handle_t& handle) -> bool
     {
-      _data[_head] = std::move(t);
-      if ((_head != _tail) or empty())
-      {
-        increment(_head);
-        ++_size;
-      }
-      else  // (head == tail) and not empty()
-      {
-        increment(_head);
-        _tail = _head;
-      }
+      return detail::is_alive(handle.connection.get());
     }
   };
 }  // namespace sqlpp::mysql::detail
@@ -90,52 +54,5 @@ namespace sqlpp::mysql::detail
 namespace sqlpp::mysql
 {
   template <::sqlpp::debug Debug>
-  class connection_pool_t
-  {
-    connection_config_t _connection_config;
-    detail::circular_connection_buffer_t _handles;
-    std::mutex _mutex;
-
-    using _connection_t = ::sqlpp::mysql::base_connection<connection_pool_t, Debug>;
-    friend _connection_t;
-
-  public:
-    connection_pool_t() = delete;
-    connection_pool_t(std::size_t capacity, connection_config_t connection_config)
-        : _connection_config(std::move(connection_config)), _handles(capacity)
-    {
-    }
-    connection_pool_t(const connection_pool_t&) = delete;
-    connection_pool_t(connection_pool_t&&) = default;
-    connection_pool_t& operator=(const connection_pool_t&) = delete;
-    connection_pool_t& operator=(connection_pool_t&&) = default;
-    ~connection_pool_t() = default;
-
-    [[nodiscard]] __attribute__((no_sanitize("memory"))) auto get() -> _connection_t
-    {
-      detail::thread_init();
-
-      const auto lock = std::scoped_lock{_mutex};
-
-      auto handle = detail::unique_connection_ptr(std::move(_handles.front()));
-      _handles.pop_front();
-
-      // destroy dead connections
-      if (handle and mysql_ping(handle.get()) != 0)
-      {
-        handle.reset();
-      }
-
-      return handle ? _connection_t{_connection_config, std::move(handle), this}
-                    : _connection_t{_connection_config, this};
-    }
-
-  private:
-    auto put(detail::unique_connection_ptr handle) -> void
-    {
-      const auto lock = std::scoped_lock{_mutex};
-      _handles.push_back(std::move(handle));
-    }
-  };
-
+  using connection_pool_t = ::sqlpp::connection_pool_t<detail::pool_traits, Debug>;
 }  // namespace sqlpp::mysql
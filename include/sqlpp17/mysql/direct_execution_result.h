@@ -32,6 +32,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <string>
 #include <string_view>
 
+#include <sqlpp17/core/blob_view.h>
+#include <sqlpp17/core/detail/parse_number.h>
 #include <sqlpp17/core/result_row.h>
 
 #include <sqlpp17/mysql/mysql.h>
@@ -77,25 +79,25 @@ namespace sqlpp ::mysql
   inline auto read_field(char* data, unsigned long length, std::int32_t& value) -> void
   {
     detail::assert_field(data);
-    value = std::strtol(data, nullptr, 10);
+    ::sqlpp::detail::parse_number(data, length, value);
   }
 
   inline auto read_field(char* data, unsigned long length, std::int64_t& value) -> void
   {
     detail::assert_field(data);
-    value = std::strtoll(data, nullptr, 10);
+    ::sqlpp::detail::parse_number(data, length, value);
   }
 
   inline auto read_field(char* data, unsigned long length, float& value) -> void
   {
     detail::assert_field(data);
-    value = std::strtof(data, nullptr);
+    ::sqlpp::detail::parse_number(data, length, value);
   }
 
   inline auto read_field(char* data, unsigned long length, double& value) -> void
   {
     detail::assert_field(data);
-    value = std::strtod(data, nullptr);
+    ::sqlpp::detail::parse_number(data, length, value);
   }
 
   inline auto read_field(char* data, unsigned long length, std::string_view& value) -> void
@@ -104,6 +106,12 @@ namespace sqlpp ::mysql
     value = std::string_view(data, length);
   }
 
+  inline auto read_field(char* data, unsigned long length, ::sqlpp::blob_view& value) -> void
+  {
+    detail::assert_field(data);
+    value = ::sqlpp::blob_view{data, length};
+  }
+
   template <typename T>
   auto read_field(char* data, unsigned long length, std::optional<T>& value) -> void
   {
@@ -195,6 +203,12 @@ namespace sqlpp ::mysql
       return _lengths;
     }
 
+    // The result is stored on the client, so its size is known (including rows that have been fetched already)
+    [[nodiscard]] auto size_hint() const -> std::size_t
+    {
+      return static_cast<std::size_t>(mysql_num_rows(_handle.get()));
+    }
+
     auto reset()
     {
       *this = direct_execution_result_t{};
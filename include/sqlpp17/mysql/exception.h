@@ -0,0 +1,70 @@
+#pragma once
+
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <string>
+
+#include <sqlpp17/core/exception.h>
+
+#include <sqlpp17/mysql/mysql.h>
+
+namespace sqlpp::mysql::detail
+{
+  // ER_QUERY_INTERRUPTED (KILL QUERY) and ER_QUERY_TIMEOUT (max_execution_time)
+  inline auto is_cancelled(unsigned int error_number) -> bool
+  {
+    return error_number == 1317 or error_number == 3024;
+  }
+
+  inline auto error_code_of(unsigned int error_number) -> ::sqlpp::error_code
+  {
+    switch (error_number)
+    {
+      case 1213:  // ER_LOCK_DEADLOCK, the transaction has been rolled back
+        return ::sqlpp::error_code::deadlock;
+      case 1205:  // ER_LOCK_WAIT_TIMEOUT
+        return ::sqlpp::error_code::lock_timeout;
+      case 2002:  // CR_CONNECTION_ERROR
+      case 2003:  // CR_CONN_HOST_ERROR
+      case 2006:  // CR_SERVER_GONE_ERROR
+      case 2013:  // CR_SERVER_LOST
+      case 2055:  // CR_SERVER_LOST_EXTENDED
+        return ::sqlpp::error_code::connection_failure;
+      default:
+        return ::sqlpp::error_code::unknown;
+    }
+  }
+
+  [[noreturn]] inline auto throw_query_error(unsigned int error_number, const std::string& message) -> void
+  {
+    if (is_cancelled(error_number))
+    {
+      throw sqlpp::cancelled_exception(message);
+    }
+    throw sqlpp::database_exception(message, error_code_of(error_number), static_cast<int>(error_number));
+  }
+}  // namespace sqlpp::mysql::detail
@@ -26,17 +26,22 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <algorithm>
 #include <array>
 #include <functional>
 #include <memory>
 #include <optional>
 #include <string>
 
+#include <sqlpp17/core/blob_view.h>
 #include <sqlpp17/core/exception.h>
 #include <sqlpp17/core/prepared_statement_parameters.h>
 #include <sqlpp17/core/result.h>
 #include <sqlpp17/core/result_row.h>
+#include <sqlpp17/core/statement_cache.h>
+#include <sqlpp17/core/transaction.h>
 
+#include <sqlpp17/mysql/exception.h>
 #include <sqlpp17/mysql/mysql.h>
 #include <sqlpp17/mysql/prepared_statement_result.h>
 
@@ -54,6 +59,26 @@ namespace sqlpp::mysql::detail
     }
   };
   using unique_prepared_statement_ptr = std::unique_ptr<MYSQL_STMT, detail::prepared_statement_cleanup_t>;
+  using statement_cache_t = ::sqlpp::detail::statement_cache_t<unique_prepared_statement_ptr>;
+  using statement_cache_ref_t = ::sqlpp::detail::statement_cache_ref_t<unique_prepared_statement_ptr>;
+
+  // Sends the BEGIN of a lazy transaction on its own, e.g. before prepared statements, which cannot be batched with
+  // text queries. The statements of a pending BEGIN are separated by "; ". BEGIN stays pending if it fails.
+  inline auto send_pending_begin(MYSQL* connection, ::sqlpp::detail::pending_begin_t& pending_begin) -> void
+  {
+    const auto& begin = *pending_begin;
+    for (auto start = std::string::size_type{0}; start < begin.size();)
+    {
+      const auto end = std::min(begin.find("; ", start), begin.size());
+      if (mysql_real_query(connection, begin.data() + start, end - start))
+      {
+        throw_query_error(mysql_errno(connection),
+                          "MySQL: Could not begin transaction: " + std::string(mysql_error(connection)));
+      }
+      start = end + 2;
+    }
+    pending_begin.reset();
+  }
 
 }  // namespace sqlpp::mysql::detail
 
@@ -165,6 +190,19 @@ namespace sqlpp::mysql
     parameter.error = nullptr;
   }
 
+  inline auto bind_parameter(bind_meta_data_t& meta_data, MYSQL_BIND& parameter, ::sqlpp::blob_view& value) -> void
+  {
+    meta_data.is_null = false;
+
+    parameter.is_null = &meta_data.is_null;
+    parameter.buffer_type = MYSQL_TYPE_BLOB;
+    parameter.buffer = const_cast<std::byte*>(value.data());
+    parameter.buffer_length = value.size();
+    parameter.length = &parameter.buffer_length;
+    parameter.is_unsigned = false;
+    parameter.error = nullptr;
+  }
+
   template <typename T>
   auto bind_parameter(bind_meta_data_t& meta_data, MYSQL_BIND& parameter, std::optional<T>& value) -> void
   {
@@ -189,6 +227,10 @@ namespace sqlpp::mysql
 #warning : This should be a tuple of correct types
     std::array<bind_meta_data_t, ParameterVector::size()> _parameter_bind_meta_data = {};
     std::array<MYSQL_BIND, ParameterVector::size()> _parameter_bind_data = {};
+    detail::statement_cache_ref_t _statement_cache;
+    std::string _cache_key;
+    MYSQL* _connection = nullptr;
+    ::sqlpp::detail::pending_begin_t* _pending_begin = nullptr;
 
   public:
     ::sqlpp::prepared_statement_parameters<ParameterVector> parameters = {};
@@ -199,6 +241,17 @@ namespace sqlpp::mysql
     {
       detail::thread_init();
       const auto sql_string = to_sql_string_c(context_t{}, statement);
+      _connection = connection.get();
+      _pending_begin = connection.get_pending_begin_state();
+
+      // The connection keeps prepared statements for reuse, e.g. by the next user of a pooled connection
+      _statement_cache = detail::statement_cache_ref_t{connection.get_statement_cache()};
+      if (auto* cache = connection.get_statement_cache(); cache and cache->enabled())
+      {
+        _cache_key = sql_string;
+        if (_handle = cache->take(sql_string); _handle)
+          return;
+      }
 
       if constexpr (Connection::is_debug_allowed())
         connection.debug("Preparing: '" + sql_string + "'");
@@ -218,7 +271,26 @@ namespace sqlpp::mysql
     prepared_statement_t(prepared_statement_t&& rhs) = default;
     prepared_statement_t& operator=(const prepared_statement_t&) = delete;
     prepared_statement_t& operator=(prepared_statement_t&&) = default;
-    ~prepared_statement_t() = default;
+    ~prepared_statement_t()
+    {
+      if (not _handle)
+        return;
+
+      if (_statement_cache.expired())
+      {
+        // The connection object is gone, its handle might be closed or used by another thread. Closing the statement
+        // would talk to the server, so it is left to the session.
+        static_cast<void>(_handle.release());
+      }
+      else if (auto* cache = _statement_cache.get(); cache and cache->enabled())
+      {
+        mysql_stmt_free_result(_handle.get());
+        if (mysql_stmt_reset(_handle.get()) == 0)
+        {
+          cache->put(std::move(_cache_key), std::move(_handle));
+        }
+      }
+    }
 
     auto execute()
     {
@@ -232,10 +304,17 @@ namespace sqlpp::mysql
                                mysql_stmt_error(_handle.get()));
       }
 
+      // First statement of a lazy transaction
+      if (_pending_begin and _pending_begin->has_value())
+      {
+        detail::send_pending_begin(_connection, *_pending_begin);
+      }
+
       if (mysql_stmt_execute(_handle.get()))
       {
-        throw sqlpp::exception(std::string("MySQL: Could not execute prepared statement: ") +
-                               mysql_stmt_error(_handle.get()));
+        detail::throw_query_error(mysql_stmt_errno(_handle.get()),
+                                  std::string("MySQL: Could not execute prepared statement: ") +
+                                      mysql_stmt_error(_handle.get()));
       }
 
       if constexpr (std::is_same_v<ResultType, insert_result>)
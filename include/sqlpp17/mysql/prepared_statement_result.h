@@ -30,11 +30,14 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <memory>
 #include <optional>
 #include <string_view>
+#include <vector>
 
+#include <sqlpp17/core/blob_view.h>
 #include <sqlpp17/core/exception.h>
 #include <sqlpp17/core/result_row.h>
 
 #include <sqlpp17/mysql/bind_meta_data.h>
+#include <sqlpp17/mysql/exception.h>
 
 namespace sqlpp::mysql::detail
 {
@@ -75,6 +78,12 @@ namespace sqlpp::mysql
     using type = std::string;
   };
 
+  template <>
+  struct value_type_buffer<::sqlpp::blob_view>
+  {
+    using type = std::vector<std::byte>;
+  };
+
   template <typename ValueType>
   struct value_type_buffer<std::optional<ValueType>>
   {
@@ -106,6 +115,38 @@ namespace sqlpp::mysql
     }
   }
 
+  inline auto refetch_truncated_field(MYSQL_STMT* stmt,
+                                      [[maybe_unused]] std::vector<std::byte>& field,
+                                      std::vector<std::byte>& buffer,
+                                      bind_meta_data_t& meta_data,
+                                      MYSQL_BIND& param,
+                                      unsigned index) -> void
+  {
+    if (meta_data.length > buffer.size())
+    {
+      buffer.resize(meta_data.length);
+      param.buffer = buffer.data();
+      param.buffer_length = buffer.size();
+
+      auto err = mysql_stmt_fetch_column(stmt, &param, index, 0);
+      if (err)
+        throw sqlpp::exception(std::string("MySQL: Fetch column after reallocate failed: ") +
+                               "error-code: " + std::to_string(err) + ", stmt-error: " + mysql_stmt_error(stmt) +
+                               ", stmt-errno: " + std::to_string(mysql_stmt_errno(stmt)) +
+                               ", field index: " + std::to_string(index));
+    }
+  }
+
+  inline auto refetch_truncated_field(MYSQL_STMT* stmt,
+                                      [[maybe_unused]] ::sqlpp::blob_view& field,
+                                      std::vector<std::byte>& buffer,
+                                      bind_meta_data_t& meta_data,
+                                      MYSQL_BIND& param,
+                                      unsigned index) -> void
+  {
+    refetch_truncated_field(stmt, buffer, buffer, meta_data, param, index);
+  }
+
   template <typename Field>
   auto refetch_truncated_field(MYSQL_STMT* stmt,
                                [[maybe_unused]] Field& field,
@@ -157,7 +198,8 @@ namespace sqlpp::mysql
         ::sqlpp::mysql::detail::bind(stmt, bind_parameters);
         return true;
       case 1:
-        throw sqlpp::exception(std::string("MySQL: Could not fetch next result: ") + mysql_stmt_error(stmt));
+        detail::throw_query_error(mysql_stmt_errno(stmt),
+                                  std::string("MySQL: Could not fetch next result: ") + mysql_stmt_error(stmt));
       case MYSQL_NO_DATA:
         return false;
       default:
@@ -247,6 +289,26 @@ namespace sqlpp::mysql
     prepare_field_meta_parameter(meta_data, bind_parameter);
   }
 
+  inline auto prepare_field_parameter(std::vector<std::byte>& field,
+                                      [[maybe_unused]] std::vector<std::byte>& buffer,
+                                      bind_meta_data_t& meta_data,
+                                      MYSQL_BIND& bind_parameter) -> void
+  {
+    bind_parameter.buffer_type = MYSQL_TYPE_BLOB;
+    bind_parameter.buffer = field.data();
+    bind_parameter.buffer_length = field.size();
+    bind_parameter.is_unsigned = false;
+    prepare_field_meta_parameter(meta_data, bind_parameter);
+  }
+
+  inline auto prepare_field_parameter([[maybe_unused]] ::sqlpp::blob_view& field,
+                                      std::vector<std::byte>& buffer,
+                                      bind_meta_data_t& meta_data,
+                                      MYSQL_BIND& bind_parameter) -> void
+  {
+    prepare_field_parameter(buffer, buffer, meta_data, bind_parameter);
+  }
+
   template <typename Field, typename Buffer>
   auto prepare_field_parameter(std::optional<Field>& field,
                                Buffer& buffer,
@@ -281,6 +343,27 @@ namespace sqlpp::mysql
     field = std::string_view{buffer.data(), meta_data.length};
   }
 
+  inline auto assign_field(::sqlpp::blob_view& field,
+                           const std::vector<std::byte>& buffer,
+                           const bind_meta_data_t& meta_data) -> void
+  {
+    field = ::sqlpp::blob_view{buffer.data(), meta_data.length};
+  }
+
+  inline auto assign_field(std::optional<::sqlpp::blob_view>& field,
+                           const std::vector<std::byte>& buffer,
+                           const bind_meta_data_t& meta_data) -> void
+  {
+    if (meta_data.is_null)
+    {
+      field.reset();
+    }
+    else
+    {
+      field = ::sqlpp::blob_view{buffer.data(), meta_data.length};
+    }
+  }
+
   template <typename Field, typename Buffer>
   auto assign_field(std::optional<Field>& field, const Buffer& buffer, const bind_meta_data_t& meta_data) -> void
   {
@@ -371,6 +454,12 @@ namespace sqlpp::mysql
       return _handle.get();
     }
 
+    // The result is stored on the client, so its size is known (including rows that have been fetched already)
+    [[nodiscard]] auto size_hint() const -> std::size_t
+    {
+      return static_cast<std::size_t>(mysql_stmt_num_rows(_handle.get()));
+    }
+
     auto reset() -> void
     {
       operator=(prepared_statement_result_t{});
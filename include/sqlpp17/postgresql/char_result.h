@@ -26,12 +26,22 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <algorithm>
+#include <array>
 #include <functional>
 #include <memory>
 #include <optional>
+#include <string>
 #include <string_view>
+#include <type_traits>
+#include <vector>
 
+#include <sqlpp17/core/blob_view.h>
+#include <sqlpp17/core/column_batch.h>
+#include <sqlpp17/core/detail/parse_number.h>
+#include <sqlpp17/core/exception.h>
 #include <sqlpp17/core/result_row.h>
+#include <sqlpp17/core/row_arena.h>
 
 #include <libpq-fe.h>
 
@@ -67,22 +77,22 @@ namespace sqlpp::postgresql
 
   inline auto read_field(PGresult* result, int row_index, std::int32_t& value, int index) -> void
   {
-    value = std::strtol(PQgetvalue(result, row_index, index), nullptr, 10);
+    ::sqlpp::detail::parse_number(PQgetvalue(result, row_index, index), PQgetlength(result, row_index, index), value);
   }
 
   inline auto read_field(PGresult* result, int row_index, std::int64_t& value, int index) -> void
   {
-    value = std::strtoll(PQgetvalue(result, row_index, index), nullptr, 10);
+    ::sqlpp::detail::parse_number(PQgetvalue(result, row_index, index), PQgetlength(result, row_index, index), value);
   }
 
   inline auto read_field(PGresult* result, int row_index, float& value, int index) -> void
   {
-    value = std::strtof(PQgetvalue(result, row_index, index), nullptr);
+    ::sqlpp::detail::parse_number(PQgetvalue(result, row_index, index), PQgetlength(result, row_index, index), value);
   }
 
   inline auto read_field(PGresult* result, int row_index, double& value, int index) -> void
   {
-    value = std::strtod(PQgetvalue(result, row_index, index), nullptr);
+    ::sqlpp::detail::parse_number(PQgetvalue(result, row_index, index), PQgetlength(result, row_index, index), value);
   }
 
   inline auto read_field(PGresult* result, int row_index, std::string_view& value, int index) -> void
@@ -98,11 +108,188 @@ namespace sqlpp::postgresql
                       std::string_view(PQgetvalue(result, row_index, index), PQgetlength(result, row_index, index))};
   }
 
+  // bytea values arrive in text format, i.e. hex encoded. They are decoded into a buffer which lives as long as the
+  // current row.
+  inline auto read_field(
+      PGresult* result, int row_index, ::sqlpp::blob_view& value, int index, std::vector<std::byte>& buffer) -> void
+  {
+    const auto* text = PQgetvalue(result, row_index, index);
+    const auto length = static_cast<std::size_t>(PQgetlength(result, row_index, index));
+
+    if (length >= 2 and text[0] == '\\' and text[1] == 'x')
+    {
+      const auto decode = [](char c) -> unsigned {
+        return (c >= '0' and c <= '9') ? c - '0' : (c >= 'a' and c <= 'f') ? c - 'a' + 10 : c - 'A' + 10;
+      };
+      buffer.resize((length - 2) / 2);
+      for (std::size_t i = 0; i < buffer.size(); ++i)
+      {
+        buffer[i] = static_cast<std::byte>((decode(text[2 + 2 * i]) << 4) | decode(text[3 + 2 * i]));
+      }
+    }
+    else
+    {
+      // bytea_output = 'escape'
+      auto size = std::size_t{};
+      auto* unescaped = PQunescapeBytea(reinterpret_cast<const unsigned char*>(text), &size);
+      if (not unescaped)
+      {
+        throw sqlpp::exception("Postgresql: Could not unescape bytea value");
+      }
+      buffer.assign(reinterpret_cast<const std::byte*>(unescaped), reinterpret_cast<const std::byte*>(unescaped) + size);
+      PQfreemem(unescaped);
+    }
+    value = ::sqlpp::blob_view{buffer.data(), buffer.size()};
+  }
+
+  inline auto read_field(PGresult* result,
+                         int row_index,
+                         std::optional<::sqlpp::blob_view>& value,
+                         int index,
+                         std::vector<std::byte>& buffer) -> void
+  {
+    if (PQgetisnull(result, row_index, index))
+    {
+      value.reset();
+    }
+    else
+    {
+      value = ::sqlpp::blob_view{};
+      read_field(result, row_index, *value, index, buffer);
+    }
+  }
+
+  template <typename Field>
+  auto read_field(
+      PGresult* result, int row_index, Field& value, int index, [[maybe_unused]] std::vector<std::byte>& buffer)
+      -> void
+  {
+    read_field(result, row_index, value, index);
+  }
+
+  template <typename... ColumnSpecs>
+  auto read_fields(PGresult* result,
+                   int row_index,
+                   result_row_t<ColumnSpecs...>& row,
+                   std::array<std::vector<std::byte>, sizeof...(ColumnSpecs)>& buffers) -> void
+  {
+    int index = -1;
+    (..., (++index, read_field(result, row_index, static_cast<result_column_base<ColumnSpecs>&>(row)(), index,
+                               buffers[index])));
+  }
+
+  // For members of user-defined structs
+  template <typename Member>
+  auto read_member(PGresult* result, int row_index, Member& member, int index, std::vector<std::byte>& buffer)
+      -> void
+  {
+    if constexpr (is_optional_v<Member>)
+    {
+      if (PQgetisnull(result, row_index, index))
+        member.reset();
+      else
+        read_member(result, row_index, member.emplace(), index, buffer);
+    }
+    else if constexpr (std::is_same_v<Member, std::string>)
+    {
+      member.assign(PQgetvalue(result, row_index, index), PQgetlength(result, row_index, index));
+    }
+    else if constexpr (std::is_same_v<Member, std::vector<std::byte>>)
+    {
+      auto value = ::sqlpp::blob_view{};
+      read_field(result, row_index, value, index, buffer);
+      member.assign(value.begin(), value.end());
+    }
+    else
+    {
+      read_field(result, row_index, member, index, buffer);
+    }
+  }
+
+  template <typename... ColumnSpecs, typename Struct>
+  auto read_members(PGresult* result,
+                    int row_index,
+                    Struct& s,
+                    std::array<std::vector<std::byte>, sizeof...(ColumnSpecs)>& buffers) -> void
+  {
+    int index = -1;
+    (..., (++index, read_member(result, row_index, get_member<ColumnSpecs>(s), index, buffers[index])));
+  }
+
+  // Decodes rows [begin, end) of a numeric column: the fields are gathered first and parsed in one batch
+  template <typename Column>
+  auto read_number_column(PGresult* result, int begin, int end, Column& column, int index) -> void
+  {
+    auto texts = std::vector<const char*>{};
+    auto lengths = std::vector<std::size_t>{};
+    texts.reserve(end - begin);
+    lengths.reserve(end - begin);
+    for (auto row_index = begin; row_index < end; ++row_index)
+    {
+      if (Column::can_be_null and PQgetisnull(result, row_index, index))
+        continue;
+      texts.push_back(PQgetvalue(result, row_index, index));
+      lengths.push_back(static_cast<std::size_t>(PQgetlength(result, row_index, index)));
+    }
+
+    auto values = std::vector<typename Column::value_type>(texts.size());
+    ::sqlpp::detail::parse_numbers(texts.data(), lengths.data(), texts.size(), values.data());
+
+    auto value = values.begin();
+    for (auto row_index = begin; row_index < end; ++row_index)
+    {
+      if constexpr (Column::can_be_null)
+      {
+        if (PQgetisnull(result, row_index, index))
+        {
+          column.push_null();
+          continue;
+        }
+      }
+      column.push_back(*value++);
+    }
+  }
+
+  // Decodes rows [begin, end) of one column
+  template <typename Column>
+  auto read_column(PGresult* result, int begin, int end, Column& column, int index, std::vector<std::byte>& buffer)
+      -> void
+  {
+    column.reserve(column.size() + (end - begin));
+    using _value_t = typename Column::value_type;
+    if constexpr (std::is_arithmetic_v<_value_t> and not std::is_same_v<_value_t, bool>)
+    {
+      read_number_column(result, begin, end, column, index);
+    }
+    else
+    {
+      for (auto row_index = begin; row_index < end; ++row_index)
+      {
+        if constexpr (Column::can_be_null)
+        {
+          if (PQgetisnull(result, row_index, index))
+          {
+            column.push_null();
+            continue;
+          }
+        }
+        auto value = _value_t{};
+        read_field(result, row_index, value, index, buffer);
+        column.push_back(value);
+      }
+    }
+  }
+
   template <typename... ColumnSpecs>
-  auto read_fields(PGresult* result, int row_index, result_row_t<ColumnSpecs...>& row) -> void
+  auto read_columns(PGresult* result,
+                    int begin,
+                    int end,
+                    column_batch_t<result_row_t<ColumnSpecs...>>& batch,
+                    std::array<std::vector<std::byte>, sizeof...(ColumnSpecs)>& buffers) -> void
   {
     int index = -1;
-    (..., (read_field(result, row_index, static_cast<result_column_base<ColumnSpecs>&>(row)(), ++index)));
+    (..., (++index, read_column(result, begin, end, static_cast<batch_column_base<ColumnSpecs>&>(batch)(), index,
+                                buffers[index])));
   }
 
   template <typename ResultRow>
@@ -117,6 +304,7 @@ namespace sqlpp::postgresql
     detail::unique_result_ptr _handle;
     int _row_index = -1;
     int _row_count;
+    std::array<std::vector<std::byte>, sizeof...(ColumnSpecs)> _blob_buffers;
 
     result_row_t<ColumnSpecs...> _row;
 
@@ -140,7 +328,7 @@ namespace sqlpp::postgresql
       ++_row_index;
       if (_row_index < get_row_count())
       {
-        read_fields(_handle.get(), _row_index, _row);
+        read_fields(_handle.get(), _row_index, _row, _blob_buffers);
       }
       else
       {
@@ -148,6 +336,56 @@ namespace sqlpp::postgresql
       }
     }
 
+    // The whole result is in memory already, so the columns are decoded one at a time
+    auto fetch_columns(column_batch_t<row_type>& batch, std::size_t max_rows) -> void
+    {
+      if (not _handle)
+        return;
+
+      const auto begin = _row_index + 1;
+      const auto end = begin + static_cast<int>(std::min(max_rows, static_cast<std::size_t>(_row_count - begin)));
+      read_columns(_handle.get(), begin, end, batch, _blob_buffers);
+      _row_index = end - 1;
+      if (end == _row_count)
+      {
+        reset();
+      }
+    }
+
+    template <typename Struct>
+    auto get_next_row_into(Struct& s) -> bool
+    {
+      if (not _handle or _row_index + 1 >= _row_count)
+      {
+        reset();
+        return false;
+      }
+      ++_row_index;
+      read_members<ColumnSpecs...>(_handle.get(), _row_index, s, _blob_buffers);
+      return true;
+    }
+
+    // Decodes a range of rows straight into the caller's rows
+    auto fetch_into(row_type* rows, std::size_t count, std::pmr::memory_resource& arena) -> std::size_t
+    {
+      if (not _handle)
+        return 0;
+
+      const auto begin = _row_index + 1;
+      const auto fetched = std::min(count, static_cast<std::size_t>(_row_count - begin));
+      for (std::size_t i = 0; i < fetched; ++i)
+      {
+        read_fields(_handle.get(), begin + static_cast<int>(i), rows[i], _blob_buffers);
+        copy_fields_to_arena(rows[i], arena);
+      }
+      _row_index = begin + static_cast<int>(fetched) - 1;
+      if (_row_index + 1 == _row_count)
+      {
+        reset();
+      }
+      return fetched;
+    }
+
     [[nodiscard]] auto& row() const
     {
       return _row;
@@ -168,6 +406,41 @@ namespace sqlpp::postgresql
       return _row_count;
     }
 
+    // Remaining rows
+    [[nodiscard]] auto size_hint() const -> std::size_t
+    {
+      return static_cast<std::size_t>(_row_count - (_row_index + 1));
+    }
+
+    // Random access to all rows, independent of the iteration position. The whole result is in memory until it has
+    // been iterated to the end.
+    [[nodiscard]] auto size() const -> std::size_t
+    {
+      return _handle ? static_cast<std::size_t>(_row_count) : 0;
+    }
+
+    // Blob fields refer to buffers that are reused by the next call
+    [[nodiscard]] auto row_at(std::size_t index) -> row_type
+    {
+      if (index >= size())
+        throw sqlpp::exception("Postgresql: Row index " + std::to_string(index) + " is out of range");
+
+      auto row = row_type{};
+      read_fields(_handle.get(), static_cast<int>(index), row, _blob_buffers);
+      return row;
+    }
+
+    // Appends rows [begin, end) to the batch. Different ranges may be decoded concurrently.
+    auto decode_columns(std::size_t begin, std::size_t end, column_batch_t<row_type>& batch) const -> void
+    {
+      if (begin > end or end > size())
+        throw sqlpp::exception("Postgresql: Row range " + std::to_string(begin) + ".." + std::to_string(end) +
+                               " is out of range");
+
+      auto blob_buffers = std::array<std::vector<std::byte>, sizeof...(ColumnSpecs)>{};
+      read_columns(_handle.get(), static_cast<int>(begin), static_cast<int>(end), batch, blob_buffers);
+    }
+
     auto reset() -> void
     {
       *this = char_result_t{};
@@ -26,22 +26,34 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
 #include <functional>
+#include <optional>
+#include <string>
 #include <type_traits>
+#include <vector>
+
+#include <poll.h>
 
 #include <sqlpp17/core/clause/command.h>
 #include <sqlpp17/core/connection.h>
 #include <sqlpp17/core/result.h>
 #include <sqlpp17/core/statement.h>
+#include <sqlpp17/core/statement_cache.h>
+#include <sqlpp17/core/transaction.h>
 
 #include <sqlpp17/postgresql/bool.h>
 #include <sqlpp17/postgresql/char_result.h>
 #include <sqlpp17/postgresql/clause.h>
 #include <sqlpp17/postgresql/connection_config.h>
 #include <sqlpp17/postgresql/context.h>
+#include <sqlpp17/postgresql/exception.h>
 #include <sqlpp17/postgresql/operator.h>
 #include <sqlpp17/postgresql/parameter.h>
 #include <sqlpp17/postgresql/prepared_statement.h>
+#include <sqlpp17/postgresql/statement_timeout.h>
 #include <sqlpp17/postgresql/to_sql_string.h>
 
 namespace sqlpp::postgresql
@@ -68,10 +80,60 @@ namespace sqlpp::postgresql::detail
   };
   using unique_connection_ptr = std::unique_ptr<PGconn, detail::connection_cleanup_t>;
 
+  // What a connection pool keeps per connection: the handle and its prepared statements
+  struct pooled_handle_t
+  {
+    unique_connection_ptr connection;
+    std::unique_ptr<statement_cache_t> statements;  // destroyed before the connection
+    std::size_t statement_index = 0;                // cached statement names must stay unique
+
+    explicit operator bool() const
+    {
+      return static_cast<bool>(connection);
+    }
+
+    auto reset() -> void
+    {
+      statements.reset();
+      connection.reset();
+    }
+  };
+
+  inline auto start_transaction_sql(const ::sqlpp::transaction_options_t& options) -> std::string
+  {
+    auto sql = std::string("START TRANSACTION");
+    if (options.isolation != ::sqlpp::isolation_level::current)
+      sql += " ISOLATION LEVEL " + std::string(::sqlpp::isolation_level_to_sql(options.isolation));
+    if (options.read_only)
+      sql += " READ ONLY";
+    if (options.deferrable)
+      sql += " DEFERRABLE";
+    return sql;
+  }
+
+  inline auto is_alive(PGconn* handle) -> bool
+  {
+#ifdef LIBPQ_HAS_PIPELINING
+    // A connection left in pipeline mode cannot execute queries
+    if (PQpipelineStatus(handle) != PQ_PIPELINE_OFF)
+      return false;
+#endif
+    return PQstatus(handle) == CONNECTION_OK;
+  }
+
   template <typename Connection, typename Statement>
   auto execute(const Connection& connection, const Statement& statement) -> detail::unique_result_ptr
   {
-    const auto sql_string = to_sql_string_c(context_t{}, statement);
+    auto sql_string = to_sql_string_c(context_t{}, statement);
+
+    // First statement of a lazy transaction: BEGIN and the statement are sent as one query, PQexec() returns the
+    // result of the last statement
+    auto* pending_begin = connection.get_pending_begin_state();
+    const auto begins_transaction = pending_begin and pending_begin->has_value();
+    if (begins_transaction)
+    {
+      sql_string = **pending_begin + "; " + sql_string;
+    }
 
     if (Connection::is_debug_allowed())
       connection.debug("Executing: '" + sql_string + "'");
@@ -79,6 +141,12 @@ namespace sqlpp::postgresql::detail
     // If one day we switch to binary format, then we could use PQexecParams with resultFormat=1
     auto result = detail::unique_result_ptr(PQexec(connection.get(), sql_string.c_str()), {});
 
+    // BEGIN stays pending if it failed, the transaction has started (possibly aborted by the statement) otherwise
+    if (begins_transaction and PQtransactionStatus(connection.get()) != PQTRANS_IDLE)
+    {
+      pending_begin->reset();
+    }
+
     if (not result)
     {
       throw sqlpp::exception("Postgresql: out of memory (query was >>" + sql_string + "<<\n");
@@ -91,25 +159,198 @@ namespace sqlpp::postgresql::detail
       case PGRES_TUPLES_OK:
         return result;
       default:
-        throw sqlpp::exception(std::string("Postgresql: Error during query execution: ") +
-                               PQresultErrorMessage(result.get()) + " (query was >>" + sql_string + "<<\n");
+        detail::throw_result_error(result.get(), std::string("Postgresql: Error during query execution: ") +
+                                                     PQresultErrorMessage(result.get()) + " (query was >>" +
+                                                     sql_string + "<<\n");
     }
   }
 
-  // direct execution
-  inline auto config_field_to_string(std::string_view name, const std::optional<std::string>& value) -> std::string
+  // Keyword and value arrays for PQconnectdbParams() and PQconnectStartParams()
+  class connection_parameters_t
+  {
+    std::vector<std::string> _values;
+    std::vector<const char*> _keywords;
+    std::vector<const char*> _value_pointers;
+
+    auto add(const char* keyword, const std::optional<std::string>& value) -> void
+    {
+      if (value)
+      {
+        _keywords.push_back(keyword);
+        _values.push_back(*value);
+      }
+    }
+
+    auto add(const char* keyword, const std::optional<int>& value) -> void
+    {
+      add(keyword, value ? std::optional<std::string>{std::to_string(*value)} : std::nullopt);
+    }
+
+    auto add(const char* keyword, const std::optional<bool>& value) -> void
+    {
+      add(keyword, value ? std::optional<std::string>{*value ? "1" : "0"} : std::nullopt);
+    }
+
+  public:
+    explicit connection_parameters_t(const connection_config_t& config)
+    {
+      add("host", config.host);
+      add("hostaddr", config.hostaddr);
+      add("port", config.port);
+      add("dbname", config.dbname);
+      add("user", config.user);
+      add("password", config.password);
+      add("passfile", config.passfile);
+      add("connect_timeout", config.connect_timeout);
+      add("client_encoding", config.client_encoding);
+      add("options", config.options);
+      add("application_name", config.application_name);
+      add("fallback_application_name", config.fallback_application_name);
+      add("keepalives", config.keepalives);
+      add("keepalives_idle", config.keepalives_idle);
+      add("keepalives_interval", config.keepalives_interval);
+      add("keepalives_count", config.keepalives_count);
+      add("sslmode", config.sslmode);
+      add("sslcompression", config.sslcompression);
+      add("sslcert", config.sslcert);
+      add("sslkey", config.sslkey);
+      add("sslrootcert", config.sslrootcert);
+      add("sslcrl", config.sslcrl);
+      add("requirepeer", config.requirepeer);
+      add("krbsrvname", config.krbsrvname);
+      add("gsslib", config.gsslib);
+      add("service", config.service);
+      add("target_session_attrs", config.target_session_attrs);
+
+      for (const auto& value : _values)
+      {
+        _value_pointers.push_back(value.c_str());
+      }
+      _keywords.push_back(nullptr);
+      _value_pointers.push_back(nullptr);
+    }
+    connection_parameters_t(const connection_parameters_t&) = delete;
+    connection_parameters_t(connection_parameters_t&&) = delete;
+    connection_parameters_t& operator=(const connection_parameters_t&) = delete;
+    connection_parameters_t& operator=(connection_parameters_t&&) = delete;
+    ~connection_parameters_t() = default;
+
+    auto keywords() const -> const char* const*
+    {
+      return _keywords.data();
+    }
+
+    auto values() const -> const char* const*
+    {
+      return _value_pointers.data();
+    }
+  };
+
+  [[noreturn]] inline auto throw_connect_error(PGconn* handle) -> void
   {
-    return value ? std::string(name) + "=" + *value + " " : "";
+    throw sqlpp::exception("Postgresql: could not connect to server: " +
+                           std::string(handle ? PQerrorMessage(handle) : "out of memory"));
   }
 
-  inline auto config_field_to_string(std::string_view name, const std::optional<int>& value) -> std::string
+  inline auto connect(const connection_config_t& config) -> unique_connection_ptr
   {
-    return value ? std::string(name) + "=" + std::to_string(*value) + " " : "";
+    if (config.pre_connect)
+    {
+      config.pre_connect(nullptr);
+    }
+
+    const auto parameters = connection_parameters_t{config};
+    auto handle = unique_connection_ptr{PQconnectdbParams(parameters.keywords(), parameters.values(), 0), {}};
+    if (PQstatus(handle.get()) != CONNECTION_OK)
+    {
+      throw_connect_error(handle.get());
+    }
+    return handle;
   }
 
-  inline auto config_field_to_string(std::string_view name, const std::optional<bool>& value) -> std::string
+  // Establishes `count` connections concurrently, multiplexing the PQconnectPoll() state machines of all of them on
+  // one poll() loop. Takes about as long as the slowest handshake instead of the sum of all handshakes.
+  inline auto connect_many(const connection_config_t& config, std::size_t count) -> std::vector<unique_connection_ptr>
   {
-    return value ? std::string(name) + "=" + std::to_string(*value) + " " : "";
+    const auto parameters = connection_parameters_t{config};
+    auto handles = std::vector<unique_connection_ptr>{};
+    auto states = std::vector<PostgresPollingStatusType>{};
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      if (config.pre_connect)
+      {
+        config.pre_connect(nullptr);
+      }
+      handles.emplace_back(PQconnectStartParams(parameters.keywords(), parameters.values(), 0));
+      if (PQstatus(handles.back().get()) == CONNECTION_BAD)
+      {
+        throw_connect_error(handles.back().get());
+      }
+      states.push_back(PGRES_POLLING_WRITING);  // as documented for the first call of PQconnectPoll()
+    }
+
+    // libpq's connect_timeout only applies to blocking connects
+    using clock = std::chrono::steady_clock;
+    auto deadline = std::optional<clock::time_point>{};
+    if (config.connect_timeout)
+    {
+      deadline = clock::now() + std::chrono::seconds{std::max(*config.connect_timeout, 2)};  // libpq's minimum is 2s
+    }
+
+    auto pending = count;
+    auto poll_fds = std::vector<pollfd>{};
+    auto poll_indexes = std::vector<std::size_t>{};
+    while (pending > 0)
+    {
+      poll_fds.clear();
+      poll_indexes.clear();
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        if (states[i] == PGRES_POLLING_READING or states[i] == PGRES_POLLING_WRITING)
+        {
+          const short events = states[i] == PGRES_POLLING_READING ? POLLIN : POLLOUT;
+          poll_fds.push_back(pollfd{PQsocket(handles[i].get()), events, 0});
+          poll_indexes.push_back(i);
+        }
+      }
+
+      auto timeout = -1;
+      if (deadline)
+      {
+        const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(*deadline - clock::now());
+        if (remaining.count() <= 0)
+        {
+          throw sqlpp::exception("Postgresql: could not connect to server: timeout expired");
+        }
+        timeout = static_cast<int>(remaining.count());
+      }
+
+      if (::poll(poll_fds.data(), poll_fds.size(), timeout) < 0)
+      {
+        if (errno == EINTR)
+          continue;
+        throw sqlpp::exception("Postgresql: could not connect to server: poll() failed");
+      }
+
+      for (std::size_t k = 0; k < poll_fds.size(); ++k)
+      {
+        if (poll_fds[k].revents == 0)
+          continue;
+
+        const auto i = poll_indexes[k];
+        states[i] = PQconnectPoll(handles[i].get());
+        if (states[i] == PGRES_POLLING_FAILED)
+        {
+          throw_connect_error(handles[i].get());
+        }
+        if (states[i] == PGRES_POLLING_OK)
+        {
+          --pending;
+        }
+      }
+    }
+
+    return handles;
   }
 
 }  // namespace sqlpp::postgresql::detail
@@ -123,8 +364,15 @@ namespace sqlpp::postgresql
   {
     using _pool_base = ::sqlpp::pool_base<Pool>;
     using _debug_base = ::sqlpp::debug_base<Debug>;
+    // Declared before the handle, so it is replaced before the handle during move assignment
+    std::unique_ptr<detail::statement_cache_t> _statement_cache;
     detail::unique_connection_ptr _handle;
     bool _transaction_active = false;
+    std::chrono::milliseconds _statement_timeout{0};
+    bool _session_dirty = false;                         // session variables or objects might have been changed
+    std::unique_ptr<::sqlpp::detail::pending_begin_t> _pending_begin =
+        std::make_unique<::sqlpp::detail::pending_begin_t>();
+    const connection_config_t* _pool_config = nullptr;  // owned by the pool
 
     mutable std::size_t _statement_index = 0;
 
@@ -136,66 +384,99 @@ namespace sqlpp::postgresql
 
     friend Pool;
 
-    base_connection(const connection_config_t& config, detail::unique_connection_ptr&& handle, Pool* connection_pool)
-        : _pool_base{connection_pool}, _debug_base{config.debug}, _handle{std::move(handle)}
+    base_connection(const connection_config_t& config, detail::pooled_handle_t&& handle, Pool* connection_pool)
+        : _pool_base{connection_pool},
+          _debug_base{config.debug},
+          _statement_cache{std::move(handle.statements)},
+          _handle{std::move(handle.connection)},
+          _statement_timeout{config.statement_timeout},
+          _pool_config{&config},
+          _statement_index{handle.statement_index}
     {
+      // Handles opened by pool_traits::open_handles() have not been set up yet
+      if (not _statement_cache)
+      {
+        set_up_session(config);
+      }
     }
 
     base_connection(const connection_config_t& config, Pool* connection_pool) : base_connection{config}
     {
       this->_connection_pool = connection_pool;
+      _pool_config = &config;
     }
 
-  public:
-    base_connection() = delete;
-    base_connection(const connection_config_t& config) : _debug_base{config.debug}, _handle{nullptr, {}}
+    auto set_up_session(const connection_config_t& config) -> void
     {
-      if (config.pre_connect)
-      {
-        config.pre_connect(get());
-      }
+      _statement_cache = std::make_unique<detail::statement_cache_t>(config.statement_cache_size);
 
-      auto conninfo = std::string{};
-      conninfo += detail::config_field_to_string("host", config.host);
-      conninfo += detail::config_field_to_string("hostaddr", config.hostaddr);
-      conninfo += detail::config_field_to_string("port", config.port);
-      conninfo += detail::config_field_to_string("dbname", config.dbname);
-      conninfo += detail::config_field_to_string("user", config.user);
-      conninfo += detail::config_field_to_string("password", config.password);
-      conninfo += detail::config_field_to_string("passfile", config.passfile);
-      conninfo += detail::config_field_to_string("connect_timeout", config.connect_timeout);
-      conninfo += detail::config_field_to_string("client_encoding", config.client_encoding);
-      conninfo += detail::config_field_to_string("options", config.options);
-      conninfo += detail::config_field_to_string("application_name", config.application_name);
-      conninfo += detail::config_field_to_string("fallback_application_name", config.fallback_application_name);
-      conninfo += detail::config_field_to_string("keepalives", config.keepalives);
-      conninfo += detail::config_field_to_string("keepalives_idle", config.keepalives_idle);
-      conninfo += detail::config_field_to_string("keepalives_interval", config.keepalives_interval);
-      conninfo += detail::config_field_to_string("keepalives_count", config.keepalives_count);
-      conninfo += detail::config_field_to_string("sslmode", config.sslmode);
-      conninfo += detail::config_field_to_string("sslcompression", config.sslcompression);
-      conninfo += detail::config_field_to_string("sslcert", config.sslcert);
-      conninfo += detail::config_field_to_string("sslkey", config.sslkey);
-      conninfo += detail::config_field_to_string("sslrootcert", config.sslrootcert);
-      conninfo += detail::config_field_to_string("sslcrl", config.sslcrl);
-      conninfo += detail::config_field_to_string("requirepeer", config.requirepeer);
-      conninfo += detail::config_field_to_string("krbsrvname", config.krbsrvname);
-      conninfo += detail::config_field_to_string("gsslib", config.gsslib);
-      conninfo += detail::config_field_to_string("service", config.service);
-      conninfo += detail::config_field_to_string("target_session_attrs", config.target_session_attrs);
-
-      _handle.reset(PQconnectdb(conninfo.c_str()));
-
-      if (PQstatus(_handle.get()) != CONNECTION_OK)
+      if (config.statement_timeout.count() > 0)
       {
-        throw sqlpp::exception("Postgresql: could not connect to server: " +
-                               std::string(PQerrorMessage(_handle.get())));
+        set_statement_timeout(config.statement_timeout);
       }
 
       if (config.post_connect)
       {
         config.post_connect(_handle.get());
       }
+
+      // The session state set up by the config is the baseline to reset to
+      _session_dirty = false;
+    }
+
+    // Returns false if the handle must not be reused
+    auto reset_session() noexcept -> bool
+    {
+      const auto policy = _pool_config->reset_on_return;
+      if (policy == ::sqlpp::session_reset::none)
+        return true;
+
+      try
+      {
+        // The transaction status is known locally, clean handles are returned without a round trip
+        switch (PQtransactionStatus(_handle.get()))
+        {
+          case PQTRANS_IDLE:
+            break;
+          case PQTRANS_INTRANS:
+            [[fallthrough]];
+          case PQTRANS_INERROR:
+            detail::execute(*this, ::sqlpp::command("ROLLBACK"));
+            break;
+          default:  // a command is still in progress or the connection is bad
+            return false;
+        }
+
+        if (_session_dirty)
+        {
+          if (policy == ::sqlpp::session_reset::full)
+          {
+            _statement_cache->release_all();  // DISCARD ALL deallocates them
+          }
+          detail::execute(*this,
+                          ::sqlpp::command(policy == ::sqlpp::session_reset::full ? "DISCARD ALL" : "RESET ALL"));
+          if (_pool_config->statement_timeout.count() > 0)
+          {
+            set_statement_timeout(_pool_config->statement_timeout);
+          }
+          if (_pool_config->post_connect)
+          {
+            _pool_config->post_connect(_handle.get());
+          }
+        }
+        return true;
+      }
+      catch (...)
+      {
+        return false;
+      }
+    }
+
+  public:
+    base_connection() = delete;
+    base_connection(const connection_config_t& config) : _debug_base{config.debug}, _handle{detail::connect(config)}
+    {
+      set_up_session(config);
     }
     base_connection(const base_connection&) = delete;
     base_connection(base_connection&&) = default;
@@ -205,9 +486,19 @@ namespace sqlpp::postgresql
     {
       if constexpr (not std::is_same_v<Pool, ::sqlpp::no_pool>)
       {
-        if (this->_connection_pool)
-          this->_connection_pool->put(std::move(_handle));
+        if (this->_connection_pool and _handle)
+        {
+          const auto reusable = reset_session();
+          // Statements that outlive this object must not return their handles to the cache from now on
+          _statement_cache->release_owner();
+          auto handle = detail::pooled_handle_t{std::move(_handle), std::move(_statement_cache), _statement_index};
+          if (reusable)
+            this->_connection_pool->put(std::move(handle));
+          else
+            this->_connection_pool->discard(std::move(handle));
+        }
       }
+      _statement_cache.reset();  // deallocates statements, requires the handle
     }
 
     template <typename... Clauses>
@@ -238,6 +529,7 @@ namespace sqlpp::postgresql
         }
         else if constexpr (std::is_same_v<ResultType, execute_result>)
         {
+          _session_dirty = true;
           return std::strtoll(PQcmdTuples(detail::execute(*this, statement).get()), nullptr, 10);
         }
         else
@@ -257,6 +549,10 @@ namespace sqlpp::postgresql
       using Statement = ::sqlpp::statement<Clauses...>;
       if constexpr (constexpr auto _check = check_statement_preparable<base_connection>(type_v<Statement>); _check)
       {
+        if constexpr (std::is_same_v<result_type_of_t<Statement>, execute_result>)
+        {
+          _session_dirty = true;
+        }
         return ::sqlpp::postgresql::prepared_statement_t{*this, statement};
       }
       else
@@ -265,14 +561,18 @@ namespace sqlpp::postgresql
       }
     }
 
-    auto start_transaction() -> void
+    // All options but options.lock are supported
+    auto start_transaction(const ::sqlpp::transaction_options_t& options = {}) -> void
     {
       if (_transaction_active)
       {
         throw sqlpp::exception("Postgresql: Cannot have more than one open transaction per connection");
       }
 
-      detail::execute(*this, sqlpp::command("START TRANSACTION"));
+      if (options.lazy)
+        *_pending_begin = detail::start_transaction_sql(options);
+      else
+        detail::execute(*this, sqlpp::command(detail::start_transaction_sql(options)));
       _transaction_active = true;
     }
 
@@ -284,7 +584,10 @@ namespace sqlpp::postgresql
       }
 
       _transaction_active = false;
-      detail::execute(*this, sqlpp::command("COMMIT"));
+      if (_pending_begin->has_value())
+        _pending_begin->reset();  // nothing to commit
+      else
+        detail::execute(*this, sqlpp::command("COMMIT"));
     }
 
     auto rollback() -> void
@@ -295,7 +598,10 @@ namespace sqlpp::postgresql
       }
 
       _transaction_active = false;
-      detail::execute(*this, sqlpp::command("ROLLBACK"));
+      if (_pending_begin->has_value())
+        _pending_begin->reset();  // nothing to roll back
+      else
+        detail::execute(*this, sqlpp::command("ROLLBACK"));
     }
 
     auto destroy_transaction() noexcept -> void
@@ -319,6 +625,11 @@ namespace sqlpp::postgresql
       return Debug == ::sqlpp::debug::allowed;
     }
 
+    static constexpr auto null_order()
+    {
+      return ::sqlpp::null_order::last;
+    }
+
     auto debug([[maybe_unused]] const std::string_view message) const
     {
       if constexpr (is_debug_allowed())
@@ -335,13 +646,47 @@ namespace sqlpp::postgresql
 
     auto is_alive() -> bool
     {
-      return PQstatus(_handle.get()) == CONNECTION_OK;
+      return detail::is_alive(_handle.get());
     }
 
     auto get_statement_index() const
     {
       return ++_statement_index;
     }
+
+    [[nodiscard]] auto get_pending_begin_state() const -> ::sqlpp::detail::pending_begin_t*
+    {
+      return _pending_begin.get();
+    }
+
+    // Statements created by prepare() are taken from and returned to this cache
+    [[nodiscard]] auto get_statement_cache() const -> detail::statement_cache_t*
+    {
+      return _statement_cache.get();
+    }
+
+    [[nodiscard]] auto statement_cache_stats() const -> ::sqlpp::statement_cache_stats_t
+    {
+      return _statement_cache->stats();
+    }
+
+    // Statements that run longer than the timeout fail with a sqlpp::cancelled_exception. 0 means no timeout.
+    auto set_statement_timeout(std::chrono::milliseconds timeout) -> void
+    {
+      detail::execute(*this, ::sqlpp::command("SET statement_timeout = " + std::to_string(timeout.count())));
+      _statement_timeout = timeout;
+      _session_dirty = true;
+    }
+
+    [[nodiscard]] auto get_statement_timeout() const -> std::chrono::milliseconds
+    {
+      return _statement_timeout;
+    }
+
+    [[nodiscard]] auto cancel_handle() const -> cancel_handle_t
+    {
+      return cancel_handle_t{_handle.get()};
+    }
   };
 
 }  // namespace sqlpp::postgresql
@@ -26,10 +26,13 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <chrono>
 #include <optional>
 
 #include <libpq-fe.h>
 
+#include <sqlpp17/core/connection.h>
+
 namespace sqlpp::postgresql
 {
   struct connection_config_t
@@ -66,6 +69,12 @@ namespace sqlpp::postgresql
     std::optional<std::string> service;
     std::optional<std::string> target_session_attrs;
 
+    std::chrono::milliseconds statement_timeout{0};  // 0: no timeout
+    std::size_t statement_cache_size = 32;           // statements kept by connection.prepare(), 0: no cache
+    // Pooled connections only. After a reset of session variables (light: RESET ALL, full: DISCARD ALL), the
+    // statement timeout and post_connect are applied again.
+    ::sqlpp::session_reset reset_on_return = ::sqlpp::session_reset::full;
+
     std::function<void(std::string_view)> debug;
 
     connection_config_t() = default;
@@ -26,63 +26,39 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
-#include <mutex>
+#include <vector>
 
+#include <sqlpp17/core/connection_pool.h>
 #include <sqlpp17/postgresql/connection.h>
 
 namespace sqlpp::postgresql::detail
 {
-  class circular_connection_buffer_t
+  struct pool_traits
   {
-    std::vector<detail::unique_connection_ptr> _data;
-    std::size_t _head = 0;
-    std::size_t _tail = 0;
-    std::size_t _size = 0;
+    using config_t = connection_config_t;
+    using handle_t = pooled_handle_t;
 
-    auto increment(std::size_t& pos)
-    {
-      ++pos;
-      if (pos == _data.size())
-        pos = 0;
-    }
-
-  public:
-    circular_connection_buffer_t(std::size_t capacity) : _data(capacity)
-    {
-    }
+    template <typename Pool, ::sqlpp::debug Debug>
+    using connection_t = base_connection<Pool, Debug>;
 
-    [[nodiscard]] auto empty() const
+    static auto thread_init() -> void
     {
-      return _size == 0;
     }
 
-    [[nodiscard]] auto& front()
+    static auto is_alive(handle_t& handle) -> bool
     {
-      return _data[_tail];
+      return detail::is_alive(handle.connection.get());
     }
 
-    auto pop_front() -> void
+    // Connections for prewarming are established concurrently, the connection constructor sets them up
+    static auto open_handles(const config_t& config, std::size_t count) -> std::vector<handle_t>
     {
-      if ((_head != _tail) or not empty())
+      auto handles = std::vector<handle_t>{};
+      for (auto& connection : connect_many(config, count))
       {
-        increment(_tail);
-        --_size;
-      }
-    }
-
-    auto push_back(detail::unique_connection_ptr t)
-    {
-      _data[_head] = std::move(t);
-      if ((_head != _tail) or empty())
-      {
-        increment(_head);
-        ++_size;
-      }
-      else  // (head == tail) and not empty()
-      {
-        increment(_head);
-        _tail = _head;
+        handles.push_back(handle_t{std::move(connection), nullptr, 0});
       }
+      return handles;
     }
   };
 }  // namespace sqlpp::postgresql::detail
@@ -90,50 +66,5 @@ namespace sqlpp::postgresql::detail
 namespace sqlpp::postgresql
 {
   template <::sqlpp::debug Debug>
-  class connection_pool_t
-  {
-    connection_config_t _connection_config;
-    detail::circular_connection_buffer_t _handles;
-    std::mutex _mutex;
-
-    using _connection_t = ::sqlpp::postgresql::base_connection<connection_pool_t, Debug>;
-    friend _connection_t;
-
-  public:
-    connection_pool_t() = delete;
-    connection_pool_t(std::size_t capacity, connection_config_t connection_config)
-        : _connection_config(std::move(connection_config)), _handles(capacity)
-    {
-    }
-    connection_pool_t(const connection_pool_t&) = delete;
-    connection_pool_t(connection_pool_t&&) = default;
-    connection_pool_t& operator=(const connection_pool_t&) = delete;
-    connection_pool_t& operator=(connection_pool_t&&) = default;
-    ~connection_pool_t() = default;
-
-    [[nodiscard]] __attribute__((no_sanitize("memory"))) auto get() -> _connection_t
-    {
-      const auto lock = std::scoped_lock{_mutex};
-
-      auto handle = detail::unique_connection_ptr(std::move(_handles.front()));
-      _handles.pop_front();
-
-      // destroy dead connections
-      if (handle and PQstatus(handle.get()) != CONNECTION_OK)
-      {
-        handle.reset();
-      }
-
-      return handle ? _connection_t{_connection_config, std::move(handle), this}
-                    : _connection_t{_connection_config, this};
-    }
-
-  private:
-    auto put(detail::unique_connection_ptr handle) -> void
-    {
-      const auto lock = std::scoped_lock{_mutex};
-      _handles.push_back(std::move(handle));
-    }
-  };
-
+  using connection_pool_t = ::sqlpp::connection_pool_t<detail::pool_traits, Debug>;
 }  // namespace sqlpp::postgresql
@@ -0,0 +1,71 @@
+#pragma once
+
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <cstring>
+#include <string>
+
+#include <libpq-fe.h>
+
+#include <sqlpp17/core/exception.h>
+
+namespace sqlpp::postgresql::detail
+{
+  // query_canceled is reported for both, explicit cancellation and statement_timeout
+  inline auto is_cancelled(const PGresult* result) -> bool
+  {
+    const auto* sql_state = PQresultErrorField(result, PG_DIAG_SQLSTATE);
+    return sql_state and std::strcmp(sql_state, "57014") == 0;
+  }
+
+  inline auto error_code_of(const char* sql_state) -> ::sqlpp::error_code
+  {
+    if (std::strcmp(sql_state, "40001") == 0)
+      return ::sqlpp::error_code::serialization_failure;
+    if (std::strcmp(sql_state, "40P01") == 0)
+      return ::sqlpp::error_code::deadlock;
+    if (std::strcmp(sql_state, "55P03") == 0)
+      return ::sqlpp::error_code::lock_timeout;
+    // Errors raised by libpq itself, e.g. after losing the connection, have no SQLSTATE
+    if (sql_state[0] == '\0' or std::strncmp(sql_state, "08", 2) == 0 or std::strcmp(sql_state, "57P01") == 0 or
+        std::strcmp(sql_state, "57P02") == 0 or std::strcmp(sql_state, "57P03") == 0)
+      return ::sqlpp::error_code::connection_failure;
+    return ::sqlpp::error_code::unknown;
+  }
+
+  [[noreturn]] inline auto throw_result_error(const PGresult* result, const std::string& message) -> void
+  {
+    if (is_cancelled(result))
+    {
+      throw sqlpp::cancelled_exception(message);
+    }
+    const auto* sql_state = PQresultErrorField(result, PG_DIAG_SQLSTATE);
+    if (not sql_state)
+      sql_state = "";
+    throw sqlpp::database_exception(message, error_code_of(sql_state), 0, sql_state);
+  }
+}  // namespace sqlpp::postgresql::detail
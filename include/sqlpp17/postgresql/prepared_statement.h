@@ -31,10 +31,17 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
 
 #include <libpq-fe.h>
 
+#include <sqlpp17/core/blob_view.h>
 #include <sqlpp17/core/prepared_statement_parameters.h>
+#include <sqlpp17/core/statement_cache.h>
+#include <sqlpp17/core/transaction.h>
+
+#include <sqlpp17/postgresql/char_result.h>
+#include <sqlpp17/postgresql/exception.h>
 
 namespace sqlpp::postgresql
 {
@@ -47,12 +54,96 @@ namespace sqlpp::postgresql
     {
       if (handle)
       {
-        PQexec(handle, ("DEALLOCATE " + _name).c_str());
+        PQclear(PQexec(handle, ("DEALLOCATE " + _name).c_str()));
       }
     }
   };
   using unique_prepared_statement_ptr = std::unique_ptr<PGconn, prepared_statement_cleanup_t>;
 
+  namespace detail
+  {
+    using statement_cache_t = ::sqlpp::detail::statement_cache_t<unique_prepared_statement_ptr>;
+    using statement_cache_ref_t = ::sqlpp::detail::statement_cache_ref_t<unique_prepared_statement_ptr>;
+
+    // Sends the pending BEGIN of a lazy transaction and executes the prepared statement in one round trip (pipeline
+    // mode), returns the result of the statement. BEGIN stays pending if it fails.
+    inline auto exec_prepared_after_begin(PGconn* connection,
+                                          ::sqlpp::detail::pending_begin_t& pending_begin,
+                                          const std::string& name,
+                                          int parameter_count,
+                                          const char* const* parameter_values,
+                                          const int* parameter_lengths,
+                                          const int* parameter_formats) -> unique_result_ptr
+    {
+      const auto& begin = *pending_begin;
+#ifdef LIBPQ_HAS_PIPELINING
+      if (not PQenterPipelineMode(connection))
+      {
+        throw sqlpp::exception("Postgresql: Could not enter pipeline mode: " + std::string(PQerrorMessage(connection)));
+      }
+
+      const auto sent =
+          PQsendQueryParams(connection, begin.c_str(), 0, nullptr, nullptr, nullptr, nullptr, 0) and
+          PQsendQueryPrepared(connection, name.c_str(), parameter_count, parameter_values, parameter_lengths,
+                              parameter_formats, 0);
+      // Also ends a partially sent pipeline, so that its results can be drained
+      const auto synced = PQpipelineSync(connection);
+
+      // Each query's results are followed by a null result, the pipeline ends with the sync result
+      auto begin_result = unique_result_ptr{};
+      auto result = unique_result_ptr{};
+      for (auto query = 0; synced and query < 3;)
+      {
+        auto next = unique_result_ptr(PQgetResult(connection), {});
+        if (not next)
+          ++query;
+        else if (PQresultStatus(next.get()) == PGRES_PIPELINE_SYNC)
+          break;
+        else
+          (query == 0 ? begin_result : result) = std::move(next);
+      }
+
+      // Fails if results are still pending. The connection cannot execute other queries then.
+      if (not PQexitPipelineMode(connection))
+      {
+        throw ::sqlpp::database_exception(
+            "Postgresql: Could not exit pipeline mode: " + std::string(PQerrorMessage(connection)),
+            ::sqlpp::error_code::connection_failure, 0);
+      }
+
+      if (not sent or not synced)
+      {
+        if (begin_result and PQresultStatus(begin_result.get()) == PGRES_COMMAND_OK)
+        {
+          pending_begin.reset();  // the transaction has started without the statement
+        }
+        throw sqlpp::exception("Postgresql: Could not send pipeline: " + std::string(PQerrorMessage(connection)));
+      }
+#else
+      auto begin_result = unique_result_ptr(PQexec(connection, begin.c_str()), {});
+      auto result = unique_result_ptr{};
+      if (begin_result and PQresultStatus(begin_result.get()) == PGRES_COMMAND_OK)
+      {
+        result = unique_result_ptr(PQexecPrepared(connection, name.c_str(), parameter_count, parameter_values,
+                                                  parameter_lengths, parameter_formats, 0),
+                                   {});
+      }
+#endif
+
+      if (not begin_result)
+      {
+        throw sqlpp::exception("Postgresql: out of memory (query was >>" + begin + "<<\n");
+      }
+      if (PQresultStatus(begin_result.get()) != PGRES_COMMAND_OK)
+      {
+        throw_result_error(begin_result.get(), std::string("Postgresql: Could not begin transaction: ") +
+                                                   PQresultErrorMessage(begin_result.get()));
+      }
+      pending_begin.reset();
+      return result;
+    }
+  }  // namespace detail
+
   inline auto bind_parameter([[maybe_unused]] std::string& parameter_string,
                              char*& parameter_pointer,
                              const std::nullopt_t& value) -> void
@@ -102,6 +193,16 @@ namespace sqlpp::postgresql
     parameter_pointer = parameter_string.data();
   }
 
+  // Blobs are passed in binary format without copying, see parameter_format()
+  inline auto bind_parameter(std::string& parameter_string, char*& parameter_pointer, ::sqlpp::blob_view& value)
+      -> void
+  {
+    // nullptr would be interpreted as NULL
+    parameter_string.clear();
+    parameter_pointer =
+        value.data() ? const_cast<char*>(reinterpret_cast<const char*>(value.data())) : parameter_string.data();
+  }
+
   template <typename T>
   auto bind_parameter(std::string& parameter_string, char*& parameter_pointer, std::optional<T>& value) -> void
   {
@@ -109,14 +210,36 @@ namespace sqlpp::postgresql
           : bind_parameter(parameter_string, parameter_pointer, std::nullopt);
   }
 
+  // Returns length and format (0: text, 1: binary) of a parameter
+  template <typename T>
+  auto parameter_format([[maybe_unused]] const T& value) -> std::pair<int, int>
+  {
+    return {0, 0};
+  }
+
+  inline auto parameter_format(const ::sqlpp::blob_view& value) -> std::pair<int, int>
+  {
+    return {static_cast<int>(value.size()), 1};
+  }
+
+  template <typename T>
+  auto parameter_format(const std::optional<T>& value) -> std::pair<int, int>
+  {
+    return value ? parameter_format(*value) : std::pair<int, int>{0, 0};
+  }
+
   template <typename... ParameterSpecs>
   auto bind_parameters(std::array<std::string, sizeof...(ParameterSpecs)>& parameter_strings,
                        std::array<char*, sizeof...(ParameterSpecs)>& parameter_pointers,
+                       std::array<int, sizeof...(ParameterSpecs)>& parameter_lengths,
+                       std::array<int, sizeof...(ParameterSpecs)>& parameter_formats,
                        ::sqlpp::prepared_statement_parameters<type_vector<ParameterSpecs...>>& parameters) -> void
   {
     int index = 0;
     (..., (bind_parameter(parameter_strings[index], parameter_pointers[index],
                           static_cast<parameter_base_t<ParameterSpecs>&>(parameters)()),
+           std::tie(parameter_lengths[index], parameter_formats[index]) =
+               parameter_format(static_cast<parameter_base_t<ParameterSpecs>&>(parameters)()),
            ++index));
   }
 
@@ -135,6 +258,11 @@ namespace sqlpp::postgresql
 
     std::array<std::string, ParameterVector::size()> _parameter_strings;
     std::array<char*, ParameterVector::size()> _parameter_pointers;
+    std::array<int, ParameterVector::size()> _parameter_lengths;
+    std::array<int, ParameterVector::size()> _parameter_formats;
+    detail::statement_cache_ref_t _statement_cache;
+    std::string _cache_key;
+    ::sqlpp::detail::pending_begin_t* _pending_begin = nullptr;
 
   public:
     ::sqlpp::prepared_statement_parameters<ParameterVector> parameters = {};
@@ -142,10 +270,24 @@ namespace sqlpp::postgresql
     prepared_statement_t() = default;
     template <typename Connection, typename Statement>
     prepared_statement_t(const Connection& connection, const Statement& statement)
-        : _name(std::to_string(connection.get_statement_index()) + "at" + std::to_string(::time(nullptr))),
-          _connection(connection.get(), {_name})
     {
       const auto sql_string = to_sql_string_c(context_t{}, statement);
+      _pending_begin = connection.get_pending_begin_state();
+
+      // The connection keeps prepared statements for reuse, e.g. by the next user of a pooled connection
+      _statement_cache = detail::statement_cache_ref_t{connection.get_statement_cache()};
+      if (auto* cache = connection.get_statement_cache(); cache and cache->enabled())
+      {
+        _cache_key = sql_string;
+        if (_connection = cache->take(sql_string); _connection)
+        {
+          _name = _connection.get_deleter()._name;
+          return;
+        }
+      }
+
+      _name = std::to_string(connection.get_statement_index()) + "at" + std::to_string(::time(nullptr));
+      _connection = unique_prepared_statement_ptr(connection.get(), {_name});
 
       if constexpr (Connection::is_debug_allowed())
         connection.debug("Preparing " + _name + ": '" + sql_string + "'");
@@ -173,15 +315,42 @@ namespace sqlpp::postgresql
     prepared_statement_t(prepared_statement_t&& rhs) = default;
     prepared_statement_t& operator=(const prepared_statement_t&) = delete;
     prepared_statement_t& operator=(prepared_statement_t&&) = default;
-    ~prepared_statement_t() = default;
+    ~prepared_statement_t()
+    {
+      if (not _connection)
+        return;
+
+      if (_statement_cache.expired())
+      {
+        // The connection object is gone, its handle might be closed or used by another thread. The statement is
+        // deallocated with the session.
+        static_cast<void>(_connection.release());
+      }
+      else if (auto* cache = _statement_cache.get(); cache and cache->enabled())
+      {
+        cache->put(std::move(_cache_key), std::move(_connection));
+      }
+    }
 
     auto execute()
     {
-      ::sqlpp::postgresql::bind_parameters(_parameter_strings, _parameter_pointers, parameters);
-      auto result =
-          detail::unique_result_ptr(PQexecPrepared(_connection.get(), _name.c_str(), _parameter_pointers.size(),
-                                                   _parameter_pointers.data(), nullptr, nullptr, 0),
-                                    {});
+      ::sqlpp::postgresql::bind_parameters(_parameter_strings, _parameter_pointers, _parameter_lengths,
+                                           _parameter_formats, parameters);
+      auto result = detail::unique_result_ptr{};
+      if (_pending_begin and _pending_begin->has_value())
+      {
+        // First statement of a lazy transaction
+        result = detail::exec_prepared_after_begin(_connection.get(), *_pending_begin, _name,
+                                                   _parameter_pointers.size(), _parameter_pointers.data(),
+                                                   _parameter_lengths.data(), _parameter_formats.data());
+      }
+      else
+      {
+        result = detail::unique_result_ptr(
+            PQexecPrepared(_connection.get(), _name.c_str(), _parameter_pointers.size(), _parameter_pointers.data(),
+                           _parameter_lengths.data(), _parameter_formats.data(), 0),
+            {});
+      }
 
       if (not result)
       {
@@ -195,8 +364,9 @@ namespace sqlpp::postgresql
         case PGRES_TUPLES_OK:
           break;
         default:
-          throw sqlpp::exception(std::string("Postgresql: Error during prepared statement execution: ") +
-                                 PQresultErrorMessage(result.get()) + " (statement name " + _name + ")\n");
+          detail::throw_result_error(result.get(),
+                                     std::string("Postgresql: Error during prepared statement execution: ") +
+                                         PQresultErrorMessage(result.get()) + " (statement name " + _name + ")\n");
       }
 
       if constexpr (std::is_same_v<ResultType, insert_result>)
@@ -0,0 +1,75 @@
+#pragma once
+
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <memory>
+
+#include <libpq-fe.h>
+
+#include <sqlpp17/core/exception.h>
+
+namespace sqlpp::postgresql::detail
+{
+  struct cancel_cleanup_t
+  {
+    auto operator()(PGcancel* handle) const noexcept -> void
+    {
+      if (handle)
+      {
+        PQfreeCancel(handle);
+      }
+    }
+  };
+  using unique_cancel_ptr = std::unique_ptr<PGcancel, cancel_cleanup_t>;
+}  // namespace sqlpp::postgresql::detail
+
+namespace sqlpp::postgresql
+{
+  // Allows to cancel the statement that is currently executed by a connection, e.g. from another thread.
+  // The handle stays valid after the connection has been closed.
+  class cancel_handle_t
+  {
+    detail::unique_cancel_ptr _handle;
+
+  public:
+    explicit cancel_handle_t(PGconn* connection) : _handle(PQgetCancel(connection))
+    {
+      if (not _handle)
+      {
+        throw sqlpp::exception("Postgresql: Could not create cancel handle");
+      }
+    }
+
+    // Requests cancellation of the running statement, which then fails with a sqlpp::cancelled_exception.
+    // Returns false if the request could not be sent. Success does not guarantee that anything was cancelled.
+    auto cancel() const -> bool
+    {
+      char error_buffer[256];
+      return PQcancel(_handle.get(), error_buffer, sizeof(error_buffer)) == 1;
+    }
+  };
+}  // namespace sqlpp::postgresql
@@ -26,6 +26,7 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <sqlpp17/core/blob_view.h>
 #include <sqlpp17/core/to_sql_string.h>
 
 #include <sqlpp17/postgresql/context.h>
@@ -47,4 +48,13 @@ namespace sqlpp
     return std::string{"-Infinity"};
   }
 
+  [[nodiscard]] inline auto to_sql_string(::sqlpp::postgresql::context_t& context, const ::sqlpp::blob_view& b)
+      -> std::string
+  {
+    auto ret = std::string{"'\\x"};
+    ::sqlpp::detail::append_hex(ret, b);
+    ret += "'::bytea";
+    return ret;
+  }
+
 }  // namespace sqlpp
@@ -28,6 +28,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <string>
 
+#include <sqlpp17/core/data_types.h>
 #include <sqlpp17/core/value_type_to_sql_string.h>
 
 namespace sqlpp::postgresql
@@ -74,4 +75,9 @@ namespace sqlpp
     return " VARCHAR(" + std::to_string(Size) + ")";
   }
 
+  [[nodiscard]] inline auto value_type_to_sql_string(::sqlpp::postgresql::context_t&, type_t<::sqlpp::blob>)
+  {
+    return " BYTEA";
+  }
+
 }  // namespace sqlpp
@@ -0,0 +1,191 @@
+#pragma once
+
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+
+#ifdef SQLPP_USE_SQLCIPHER
+#include <sqlcipher/sqlite3.h>
+#else
+#include <sqlite3.h>
+#endif
+
+#include <sqlpp17/core/blob_view.h>
+#include <sqlpp17/core/column.h>
+#include <sqlpp17/core/data_types.h>
+#include <sqlpp17/core/exception.h>
+#include <sqlpp17/core/to_sql_name.h>
+
+#include <sqlpp17/sqlite3/context.h>
+
+// Incremental blob I/O, see https://www.sqlite.org/c3ref/blob_open.html
+//
+// sqlite3 cannot change the size of a blob via incremental I/O. Rows that are to be written in pieces are therefore
+// created with a zero-filled blob of the final size, e.g. by inserting zeroblob(size).
+
+namespace sqlpp::sqlite3::detail
+{
+  struct blob_cleanup_t
+  {
+    auto operator()(::sqlite3_blob* handle) const noexcept -> void
+    {
+      if (handle)
+      {
+        sqlite3_blob_close(handle);
+      }
+    }
+  };
+  using unique_blob_ptr = std::unique_ptr<::sqlite3_blob, blob_cleanup_t>;
+}  // namespace sqlpp::sqlite3::detail
+
+namespace sqlpp::sqlite3
+{
+  // A blob of the given size, filled with zeros, without materializing it on the client side
+  struct zeroblob_t
+  {
+    std::int64_t _size;
+  };
+
+  [[nodiscard]] inline auto zeroblob(std::int64_t size)
+  {
+    return zeroblob_t{size};
+  }
+
+  template <typename Context>
+  [[nodiscard]] auto to_sql_string([[maybe_unused]] Context& context, const zeroblob_t& t)
+  {
+    return "zeroblob(" + std::to_string(t._size) + ")";
+  }
+
+  enum class blob_mode
+  {
+    read_only,
+    read_write,
+  };
+
+  class blob_stream_t
+  {
+    detail::unique_blob_ptr _handle;
+    ::sqlite3* _connection = nullptr;
+
+    [[noreturn]] auto throw_error(const std::string& what) const -> void
+    {
+      throw sqlpp::exception("Sqlite3: Could not " + what + ": " + std::string(sqlite3_errmsg(_connection)));
+    }
+
+  public:
+    blob_stream_t() = default;
+
+    // Opens the blob in the given column of the row with the given rowid
+    template <typename Connection, typename TableSpec, typename ColumnSpec>
+    blob_stream_t(const Connection& connection,
+                  const ::sqlpp::column_t<TableSpec, ColumnSpec>&,
+                  std::int64_t rowid,
+                  blob_mode mode = blob_mode::read_only,
+                  const char* database = "main")
+        : _connection(connection.get())
+    {
+      static_assert(::sqlpp::is_blob_v<typename ColumnSpec::value_type>, "blob streams require a blob column");
+
+      auto context = ::sqlpp::sqlite3::context_t{};
+      ::sqlite3_blob* handle = nullptr;
+      const auto rc = sqlite3_blob_open(_connection, database, to_sql_name(context, TableSpec{}).c_str(),
+                                        to_sql_name(context, ColumnSpec{}).c_str(), rowid,
+                                        mode == blob_mode::read_write, &handle);
+      _handle.reset(handle);
+      if (rc != SQLITE_OK)
+      {
+        throw_error("open blob");
+      }
+    }
+
+    blob_stream_t(const blob_stream_t&) = delete;
+    blob_stream_t(blob_stream_t&& rhs) = default;
+    blob_stream_t& operator=(const blob_stream_t&) = delete;
+    blob_stream_t& operator=(blob_stream_t&&) = default;
+    ~blob_stream_t() = default;
+
+    [[nodiscard]] auto size() const -> std::size_t
+    {
+      return static_cast<std::size_t>(sqlite3_blob_bytes(_handle.get()));
+    }
+
+    // Reads size bytes, starting at offset
+    auto read(std::byte* target, std::size_t size, std::size_t offset) const -> void
+    {
+      if (size > static_cast<std::size_t>(std::numeric_limits<int>::max()) or offset > this->size())
+      {
+        throw sqlpp::exception("Sqlite3: blob read out of range");
+      }
+      if (sqlite3_blob_read(_handle.get(), target, static_cast<int>(size), static_cast<int>(offset)) != SQLITE_OK)
+      {
+        throw_error("read blob");
+      }
+    }
+
+    // Writes data, starting at offset. The blob cannot grow.
+    auto write(::sqlpp::blob_view data, std::size_t offset) -> void
+    {
+      if (data.size() > static_cast<std::size_t>(std::numeric_limits<int>::max()) or offset > size())
+      {
+        throw sqlpp::exception("Sqlite3: blob write out of range");
+      }
+      if (sqlite3_blob_write(_handle.get(), data.data(), static_cast<int>(data.size()), static_cast<int>(offset)) !=
+          SQLITE_OK)
+      {
+        throw_error("write blob");
+      }
+    }
+
+    // Moves the stream to the same column of another row, which is cheaper than opening a new stream
+    auto reopen(std::int64_t rowid) -> void
+    {
+      if (sqlite3_blob_reopen(_handle.get(), rowid) != SQLITE_OK)
+      {
+        throw_error("reopen blob");
+      }
+    }
+
+    [[nodiscard]] auto* get() const
+    {
+      return _handle.get();
+    }
+  };
+}  // namespace sqlpp::sqlite3
+
+namespace sqlpp
+{
+  template <>
+  struct value_type_of<::sqlpp::sqlite3::zeroblob_t>
+  {
+    using type = ::sqlpp::blob;
+  };
+}  // namespace sqlpp
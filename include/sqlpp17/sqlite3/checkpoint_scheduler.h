@@ -0,0 +1,290 @@
+#pragma once
+
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#ifdef SQLPP_USE_SQLCIPHER
+#include <sqlcipher/sqlite3.h>
+#else
+#include <sqlite3.h>
+#endif
+
+#include <sqlpp17/core/exception.h>
+
+#include <sqlpp17/sqlite3/connection.h>
+#include <sqlpp17/sqlite3/connection_config.h>
+
+// Background WAL checkpoints, see https://www.sqlite.org/wal.html#ckpt
+//
+// By default, sqlite3 checkpoints the WAL inline, during the commit that crosses the auto-checkpoint threshold.
+// The scheduler disables auto-checkpoints for attached connections and runs checkpoints from its own thread and
+// connection instead.
+//
+// Attached connections report the WAL size after each commit. The scheduler runs a PASSIVE checkpoint when the WAL
+// exceeds passive_threshold_frames or when the interval has passed, and a TRUNCATE checkpoint (which waits for
+// readers and writers) when the WAL exceeds truncate_threshold_frames.
+//
+// The scheduler must outlive attached connections or they must be detached before it is destroyed.
+
+namespace sqlpp::sqlite3
+{
+  struct checkpoint_config_t
+  {
+    std::int64_t passive_threshold_frames = 1000;
+    std::int64_t truncate_threshold_frames = 100000;
+    std::chrono::milliseconds interval{1000};
+    std::chrono::milliseconds truncate_busy_timeout{100};  // how long TRUNCATE may wait for readers and writers
+  };
+
+  struct checkpoint_metrics_t
+  {
+    std::int64_t wal_frames = 0;           // frames in the WAL, as reported by the last commit or checkpoint
+    std::int64_t checkpointed_frames = 0;  // frames copied back into the database by the last checkpoint
+    std::int64_t wal_bytes = 0;            // estimated size of the WAL file
+    std::int64_t passive_checkpoints = 0;
+    std::int64_t truncate_checkpoints = 0;
+    std::int64_t busy_checkpoints = 0;  // checkpoints that could not complete because of readers or writers
+    std::int64_t failed_checkpoints = 0;
+    std::chrono::microseconds last_duration{0};
+    std::chrono::microseconds max_duration{0};
+  };
+
+  class checkpoint_scheduler_t
+  {
+    using _clock = std::chrono::steady_clock;
+
+    checkpoint_config_t _config;
+    connection_t<::sqlpp::debug::none> _connection;
+    std::int64_t _page_size = 4096;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _condition;
+    bool _stop = false;
+    bool _checkpoint_requested = false;
+    checkpoint_metrics_t _metrics;
+
+    std::atomic<std::int64_t> _wal_frames{0};
+    std::thread _thread;
+
+    static auto on_commit(void* self, ::sqlite3*, const char*, int frames) -> int
+    {
+      static_cast<checkpoint_scheduler_t*>(self)->report_wal_frames(frames);
+      return SQLITE_OK;
+    }
+
+    static auto scheduler_config(connection_config_t config) -> connection_config_t
+    {
+      config.post_connect = nullptr;
+      config.statement_timeout = std::chrono::milliseconds{0};
+      return config;
+    }
+
+    auto report_wal_frames(std::int64_t frames) -> void
+    {
+      const auto previous = _wal_frames.exchange(frames, std::memory_order_relaxed);
+      if (frames >= _config.passive_threshold_frames and previous < _config.passive_threshold_frames)
+      {
+        // Synchronize with the scheduler thread, which might be about to wait
+        {
+          const auto lock = std::scoped_lock{_mutex};
+        }
+        _condition.notify_one();
+      }
+    }
+
+    // Reading from the database opens the WAL (if any) for this connection
+    auto read_schema_version() -> void
+    {
+      ::sqlite3_stmt* statement = nullptr;
+      if (sqlite3_prepare_v2(_connection.get(), "PRAGMA schema_version", -1, &statement, nullptr) == SQLITE_OK)
+      {
+        sqlite3_step(statement);
+      }
+      sqlite3_finalize(statement);
+    }
+
+    auto checkpoint(int mode, std::int64_t wal_frames) -> void
+    {
+      if (mode == SQLITE_CHECKPOINT_TRUNCATE)
+        sqlite3_busy_timeout(_connection.get(), static_cast<int>(_config.truncate_busy_timeout.count()));
+
+      auto log_frames = 0;
+      auto checkpointed_frames = 0;
+      const auto start = _clock::now();
+      auto rc = sqlite3_wal_checkpoint_v2(_connection.get(), nullptr, mode, &log_frames, &checkpointed_frames);
+      if (rc == SQLITE_OK and log_frames == -1)
+      {
+        // This connection has not seen the database in WAL mode yet
+        read_schema_version();
+        rc = sqlite3_wal_checkpoint_v2(_connection.get(), nullptr, mode, &log_frames, &checkpointed_frames);
+      }
+      const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(_clock::now() - start);
+
+      if (mode == SQLITE_CHECKPOINT_TRUNCATE)
+        sqlite3_busy_timeout(_connection.get(), 0);
+
+      // If everything was copied, the next writer restarts the WAL from the beginning. Unless a writer has reported a
+      // different size in the meantime, the WAL can be considered empty.
+      if (rc == SQLITE_OK and log_frames == -1)
+      {
+        rc = SQLITE_ERROR;  // not in WAL mode
+      }
+      else if (rc == SQLITE_OK and (mode == SQLITE_CHECKPOINT_TRUNCATE or log_frames == checkpointed_frames))
+      {
+        _wal_frames.compare_exchange_strong(wal_frames, 0, std::memory_order_relaxed);
+      }
+
+      const auto lock = std::scoped_lock{_mutex};
+      switch (rc)
+      {
+        case SQLITE_OK:
+          ++(mode == SQLITE_CHECKPOINT_TRUNCATE ? _metrics.truncate_checkpoints : _metrics.passive_checkpoints);
+          break;
+        case SQLITE_BUSY:
+          ++_metrics.busy_checkpoints;
+          break;
+        default:
+          ++_metrics.failed_checkpoints;
+      }
+      _metrics.checkpointed_frames = checkpointed_frames;
+      _metrics.last_duration = duration;
+      _metrics.max_duration = std::max(_metrics.max_duration, duration);
+    }
+
+    auto run() -> void
+    {
+      auto lock = std::unique_lock{_mutex};
+      while (not _stop)
+      {
+        _condition.wait_for(lock, _config.interval, [this]() {
+          return _stop or _checkpoint_requested or
+                 _wal_frames.load(std::memory_order_relaxed) >= _config.passive_threshold_frames;
+        });
+        if (_stop)
+          break;
+
+        _checkpoint_requested = false;
+        const auto frames = _wal_frames.load(std::memory_order_relaxed);
+        if (frames == 0)
+          continue;
+
+        lock.unlock();
+        checkpoint(frames >= _config.truncate_threshold_frames ? SQLITE_CHECKPOINT_TRUNCATE : SQLITE_CHECKPOINT_PASSIVE,
+                   frames);
+        lock.lock();
+      }
+    }
+
+  public:
+    checkpoint_scheduler_t(const connection_config_t& connection_config, checkpoint_config_t config = {})
+        : _config(config), _connection(scheduler_config(connection_config))
+    {
+      ::sqlite3_stmt* statement = nullptr;
+      if (sqlite3_prepare_v2(_connection.get(), "PRAGMA page_size", -1, &statement, nullptr) == SQLITE_OK and
+          sqlite3_step(statement) == SQLITE_ROW)
+      {
+        _page_size = sqlite3_column_int64(statement, 0);
+      }
+      sqlite3_finalize(statement);
+      read_schema_version();
+
+      _thread = std::thread{[this]() { run(); }};
+    }
+
+    checkpoint_scheduler_t(const checkpoint_scheduler_t&) = delete;
+    checkpoint_scheduler_t(checkpoint_scheduler_t&&) = delete;
+    checkpoint_scheduler_t& operator=(const checkpoint_scheduler_t&) = delete;
+    checkpoint_scheduler_t& operator=(checkpoint_scheduler_t&&) = delete;
+
+    ~checkpoint_scheduler_t()
+    {
+      {
+        const auto lock = std::scoped_lock{_mutex};
+        _stop = true;
+      }
+      _condition.notify_one();
+      _thread.join();
+    }
+
+    // Disables auto-checkpoints for the connection and makes it report its WAL size to the scheduler
+    auto attach(::sqlite3* connection) -> void
+    {
+      sqlite3_wal_autocheckpoint(connection, 0);  // also removes any previous wal hook
+      sqlite3_wal_hook(connection, &on_commit, this);
+    }
+
+    template <typename Connection>
+    auto attach(const Connection& connection) -> decltype(connection.get(), void())
+    {
+      attach(connection.get());
+    }
+
+    // For use as (or in) connection_config_t::post_connect, e.g. to attach all connections of a pool
+    [[nodiscard]] auto attach_function() -> std::function<void(::sqlite3*)>
+    {
+      return [this](::sqlite3* connection) { attach(connection); };
+    }
+
+    auto detach(::sqlite3* connection) -> void
+    {
+      sqlite3_wal_hook(connection, nullptr, nullptr);
+    }
+
+    template <typename Connection>
+    auto detach(const Connection& connection) -> decltype(connection.get(), void())
+    {
+      detach(connection.get());
+    }
+
+    // Wakes up the scheduler to checkpoint now (if there is anything to checkpoint)
+    auto request_checkpoint() -> void
+    {
+      {
+        const auto lock = std::scoped_lock{_mutex};
+        _checkpoint_requested = true;
+      }
+      _condition.notify_one();
+    }
+
+    [[nodiscard]] auto metrics() const -> checkpoint_metrics_t
+    {
+      const auto lock = std::scoped_lock{_mutex};
+      auto metrics = _metrics;
+      metrics.wal_frames = _wal_frames.load(std::memory_order_relaxed);
+      metrics.wal_bytes = metrics.wal_frames > 0 ? 32 + metrics.wal_frames * (_page_size + 24) : 0;
+      return metrics;
+    }
+  };
+}  // namespace sqlpp::sqlite3
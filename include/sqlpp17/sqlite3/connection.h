@@ -26,7 +26,9 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <chrono>
 #include <functional>
+#include <memory>
 #include <type_traits>
 
 #include <sqlpp17/core/clause/command.h>
@@ -34,6 +36,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <sqlpp17/core/exception.h>
 #include <sqlpp17/core/result.h>
 #include <sqlpp17/core/statement.h>
+#include <sqlpp17/core/statement_cache.h>
+#include <sqlpp17/core/transaction.h>
 
 #include <sqlpp17/sqlite3/clause.h>
 #include <sqlpp17/sqlite3/connection_config.h>
@@ -42,6 +46,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <sqlpp17/sqlite3/parameter.h>
 #include <sqlpp17/sqlite3/prepared_statement.h>
 #include <sqlpp17/sqlite3/prepared_statement_result.h>
+#include <sqlpp17/sqlite3/statement_stats.h>
+#include <sqlpp17/sqlite3/statement_timeout.h>
 
 namespace sqlpp::sqlite3
 {
@@ -67,6 +73,44 @@ namespace sqlpp::sqlite3::detail
   };
   using unique_connection_ptr = std::unique_ptr<::sqlite3, detail::connection_cleanup_t>;
 
+  // What a connection pool keeps per connection: the handle and its prepared statements
+  struct pooled_handle_t
+  {
+    unique_connection_ptr connection;
+    std::unique_ptr<statement_cache_t> statements;  // destroyed before the connection
+
+    explicit operator bool() const
+    {
+      return static_cast<bool>(connection);
+    }
+
+    auto reset() -> void
+    {
+      statements.reset();
+      connection.reset();
+    }
+  };
+
+  inline auto begin_transaction_sql(const ::sqlpp::transaction_options_t& options) -> std::string
+  {
+    switch (options.lock)
+    {
+      case ::sqlpp::transaction_lock::immediate:
+        return "BEGIN IMMEDIATE TRANSACTION";
+      case ::sqlpp::transaction_lock::exclusive:
+        return "BEGIN EXCLUSIVE TRANSACTION";
+      case ::sqlpp::transaction_lock::deferred:
+        break;
+    }
+    return "BEGIN TRANSACTION";
+  }
+
+  // Sqlite3 connections do not drop, this only checks that the handle still executes statements
+  inline auto is_alive(::sqlite3* handle) -> bool
+  {
+    return sqlite3_exec(handle, "SELECT 1", nullptr, nullptr, nullptr) == SQLITE_OK;
+  }
+
 }  // namespace sqlpp::sqlite3::detail
 
 namespace sqlpp::sqlite3
@@ -79,8 +123,16 @@ namespace sqlpp::sqlite3
     using _pool_base = ::sqlpp::pool_base<Pool>;
     using _debug_base = ::sqlpp::debug_base<Debug>;
 
+    // Declared before the handle, so it is replaced before the handle during move assignment
+    std::unique_ptr<detail::statement_timeout_t> _statement_timeout;
+    std::unique_ptr<statement_stats_t> _last_statement_stats;  // only if config.collect_statement_stats
+    std::unique_ptr<::sqlpp::detail::pending_begin_t> _pending_begin =
+        std::make_unique<::sqlpp::detail::pending_begin_t>();
     detail::unique_connection_ptr _handle;
+    std::unique_ptr<detail::statement_cache_t> _statement_cache;  // declared after the handle to be destroyed first
     bool _transaction_active = false;
+    bool _session_dirty = false;  // e.g. temp tables might have been created
+    ::sqlpp::session_reset _reset_on_return = ::sqlpp::session_reset::none;
 
     template <typename... Clauses>
     friend class ::sqlpp::statement;
@@ -90,14 +142,54 @@ namespace sqlpp::sqlite3
 
     friend Pool;
 
-    base_connection(const connection_config_t& config, detail::unique_connection_ptr&& handle, Pool* connection_pool)
-        : _pool_base{connection_pool}, _debug_base{config.debug}, _handle{std::move(handle)}
+    base_connection(const connection_config_t& config, detail::pooled_handle_t&& handle, Pool* connection_pool)
+        : _pool_base{connection_pool},
+          _debug_base{config.debug},
+          _handle{std::move(handle.connection)},
+          _statement_cache{std::move(handle.statements)},
+          _reset_on_return{config.reset_on_return}
     {
+      _statement_timeout = std::make_unique<detail::statement_timeout_t>(_handle.get());
+      _statement_timeout->set(config.statement_timeout);
+      if (config.collect_statement_stats)
+      {
+        _last_statement_stats = std::make_unique<statement_stats_t>();
+      }
     }
 
     base_connection(const connection_config_t& config, Pool* connection_pool) : base_connection{config}
     {
       this->_connection_pool = connection_pool;
+      _reset_on_return = config.reset_on_return;
+    }
+
+    // Returns false if the handle must not be reused
+    auto reset_session() noexcept -> bool
+    {
+      if (_reset_on_return == ::sqlpp::session_reset::none)
+        return true;
+
+      // The transaction state is known locally, clean handles are returned without a round trip
+      try
+      {
+        // Cached statements might refer to objects of this session
+        if (_session_dirty and _reset_on_return == ::sqlpp::session_reset::full)
+        {
+          _statement_cache->clear();
+        }
+
+        if (sqlite3_get_autocommit(_handle.get()))
+          return true;
+
+        if (is_debug_allowed())
+          debug("Rolling back open transaction before returning connection to pool");
+
+        return sqlite3_exec(_handle.get(), "ROLLBACK", nullptr, nullptr, nullptr) == SQLITE_OK;
+      }
+      catch (...)
+      {
+        return false;
+      }
     }
 
   public:
@@ -127,6 +219,14 @@ namespace sqlpp::sqlite3
       }
 #endif
 
+      _statement_timeout = std::make_unique<detail::statement_timeout_t>(_handle.get());
+      _statement_timeout->set(config.statement_timeout);
+      if (config.collect_statement_stats)
+      {
+        _last_statement_stats = std::make_unique<statement_stats_t>();
+      }
+      _statement_cache = std::make_unique<detail::statement_cache_t>(config.statement_cache_size);
+
       if (config.post_connect)
       {
         config.post_connect(_handle.get());
@@ -139,15 +239,26 @@ namespace sqlpp::sqlite3
     base_connection& operator=(base_connection&&) = default;
     ~base_connection()
     {
+      _statement_timeout.reset();
       if constexpr (not std::is_same_v<Pool, ::sqlpp::no_pool>)
       {
-        if (this->_connection_pool)
-          this->_connection_pool->put(std::move(_handle));
+        if (this->_connection_pool and _handle)
+        {
+          const auto reusable = reset_session();
+          // Statements that outlive this object must not return their handles to the cache from now on
+          _statement_cache->release_owner();
+          auto handle = detail::pooled_handle_t{std::move(_handle), std::move(_statement_cache)};
+          if (reusable)
+            this->_connection_pool->put(std::move(handle));
+          else
+            this->_connection_pool->discard(std::move(handle));
+        }
       }
     }
 
     auto operator()(const std::string& sql_string)
     {
+      _session_dirty = true;
       auto prepared_statement = prepared_statement_t<::sqlpp::execute_result, ::sqlpp::type_vector<>, ::sqlpp::none_t>{
           *this, sql_string, detail::result_owns_statement{true}};
       prepared_statement.execute();
@@ -197,6 +308,10 @@ namespace sqlpp::sqlite3
       using Statement = ::sqlpp::statement<Clauses...>;
       if constexpr (constexpr auto _check = check_statement_preparable<base_connection>(type_v<Statement>); _check)
       {
+        if constexpr (std::is_same_v<result_type_of_t<Statement>, execute_result>)
+        {
+          _session_dirty = true;
+        }
         return ::sqlpp::sqlite3::prepared_statement_t{*this, statement, detail::result_owns_statement{false}};
       }
       else
@@ -205,15 +320,23 @@ namespace sqlpp::sqlite3
       }
     }
 
-    auto start_transaction() -> void
+    // options.lock and options.lazy are supported
+    auto start_transaction(const ::sqlpp::transaction_options_t& options = {}) -> void
     {
       if (_transaction_active)
       {
         throw sqlpp::exception("Sqlite3: Cannot have more than one open transaction per connection");
       }
 
-      auto prepared_statement =
-          prepared_statement_t{*this, ::sqlpp::command("BEGIN TRANSACTION"), detail::result_owns_statement{true}};
+      if (options.lazy)
+      {
+        *_pending_begin = detail::begin_transaction_sql(options);
+        _transaction_active = true;
+        return;
+      }
+
+      auto prepared_statement = prepared_statement_t{*this, ::sqlpp::command(detail::begin_transaction_sql(options)),
+                                                     detail::result_owns_statement{true}};
       prepared_statement.execute();
       _transaction_active = true;
     }
@@ -226,9 +349,26 @@ namespace sqlpp::sqlite3
       }
 
       _transaction_active = false;
-      auto prepared_statement =
-          prepared_statement_t{*this, ::sqlpp::command("COMMIT"), detail::result_owns_statement{true}};
-      prepared_statement.execute();
+      if (_pending_begin->has_value())
+      {
+        _pending_begin->reset();  // nothing to commit
+        return;
+      }
+      try
+      {
+        auto prepared_statement =
+            prepared_statement_t{*this, ::sqlpp::command("COMMIT"), detail::result_owns_statement{true}};
+        prepared_statement.execute();
+      }
+      catch (const sqlpp::exception&)
+      {
+        // A failed COMMIT (e.g. SQLITE_BUSY) leaves the transaction open, end it like the other connectors do
+        if (not sqlite3_get_autocommit(_handle.get()))
+        {
+          sqlite3_exec(_handle.get(), "ROLLBACK", nullptr, nullptr, nullptr);
+        }
+        throw;
+      }
     }
 
     auto rollback() -> void
@@ -239,6 +379,11 @@ namespace sqlpp::sqlite3
       }
 
       _transaction_active = false;
+      if (_pending_begin->has_value())
+      {
+        _pending_begin->reset();  // nothing to roll back
+        return;
+      }
       auto prepared_statement =
           prepared_statement_t{*this, ::sqlpp::command("ROLLBACK"), detail::result_owns_statement{true}};
       prepared_statement.execute();
@@ -265,6 +410,11 @@ namespace sqlpp::sqlite3
       return Debug == ::sqlpp::debug::allowed;
     }
 
+    static constexpr auto null_order()
+    {
+      return ::sqlpp::null_order::first;
+    }
+
     auto debug([[maybe_unused]] const std::string_view message) const
     {
       if constexpr (is_debug_allowed())
@@ -279,7 +429,71 @@ namespace sqlpp::sqlite3
       return _handle.get();
     }
 
-    auto is_alive() -> bool;
+    auto is_alive() -> bool
+    {
+      return detail::is_alive(_handle.get());
+    }
+
+    // Statements that run longer than the timeout fail with a sqlpp::cancelled_exception. 0 means no timeout.
+    // Only time spent in SQLite counts, not the time spent processing rows between two steps.
+    auto set_statement_timeout(std::chrono::milliseconds timeout) -> void
+    {
+      _statement_timeout->set(timeout);
+    }
+
+    [[nodiscard]] auto get_statement_timeout() const -> std::chrono::milliseconds
+    {
+      return _statement_timeout->get();
+    }
+
+    [[nodiscard]] auto get_statement_timeout_state() const -> detail::statement_timeout_t*
+    {
+      return _statement_timeout.get();
+    }
+
+    [[nodiscard]] auto get_pending_begin_state() const -> ::sqlpp::detail::pending_begin_t*
+    {
+      return _pending_begin.get();
+    }
+
+    [[nodiscard]] auto cancel_handle() const -> cancel_handle_t
+    {
+      return cancel_handle_t{_handle.get()};
+    }
+
+    // Engine counters of the most recently completed statement (selects complete when their result is exhausted or
+    // destroyed). Requires config.collect_statement_stats.
+    [[nodiscard]] auto last_statement_stats() const -> statement_stats_t
+    {
+      if (not _last_statement_stats)
+      {
+        throw sqlpp::exception(
+            "Sqlite3: Statement stats are not collected, see connection_config_t::collect_statement_stats");
+      }
+      return *_last_statement_stats;
+    }
+
+    [[nodiscard]] auto get_statement_stats_state() const -> statement_stats_t*
+    {
+      return _last_statement_stats.get();
+    }
+
+    // Statements created by prepare() are taken from and returned to this cache
+    [[nodiscard]] auto get_statement_cache() const -> detail::statement_cache_t*
+    {
+      return _statement_cache.get();
+    }
+
+    [[nodiscard]] auto statement_cache_stats() const -> ::sqlpp::statement_cache_stats_t
+    {
+      return _statement_cache->stats();
+    }
+
+    // Page cache hits/misses since the connection was opened or the last reset
+    [[nodiscard]] auto cache_stats(bool reset = false) const -> cache_stats_t
+    {
+      return read_cache_stats(_handle.get(), reset);
+    }
 
   private:
     template <typename... Clauses>
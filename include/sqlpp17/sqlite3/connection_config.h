@@ -26,12 +26,16 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <chrono>
+
 #ifdef SQLPP_USE_SQLCIPHER
 #include <sqlcipher/sqlite3.h>
 #else
 #include <sqlite3.h>
 #endif
 
+#include <sqlpp17/core/connection.h>
+
 namespace sqlpp::sqlite3
 {
   struct connection_config_t
@@ -41,6 +45,11 @@ namespace sqlpp::sqlite3
     std::string password;
     int flags = 0;
     std::string vfs;
+    std::chrono::milliseconds statement_timeout{0};  // 0: no timeout
+    bool collect_statement_stats = false;            // see connection.last_statement_stats()
+    std::size_t statement_cache_size = 32;           // statements kept by connection.prepare(), 0: no cache
+    // Pooled connections only. Open transactions are rolled back, light and full are equivalent.
+    ::sqlpp::session_reset reset_on_return = ::sqlpp::session_reset::full;
     std::function<void(std::string_view)> debug;
 
     connection_config_t() = default;
@@ -26,66 +26,26 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
-#include <mutex>
-#include <vector>
-
+#include <sqlpp17/core/connection_pool.h>
 #include <sqlpp17/sqlite3/connection.h>
 
 namespace sqlpp::sqlite3::detail
 {
-  class circular_connection_buffer_t
+  struct pool_traits
   {
-    std::vector<detail::unique_connection_ptr> _data;
-    std::size_t _head = 0;
-    std::size_t _tail = 0;
-    std::size_t _size = 0;
-
-    auto increment(std::size_t& pos)
-    {
-      ++pos;
-      if (pos == _data.size())
-        pos = 0;
-    }
-
-  public:
-    circular_connection_buffer_t(std::size_t capacity) : _data(capacity)
-    {
-    }
+    using config_t = connection_config_t;
+    using handle_t = pooled_handle_t;
 
-    [[nodiscard]] auto empty() const
-    {
-      return _size == 0;
-    }
+    template <typename Pool, ::sqlpp::debug Debug>
+    using connection_t = base_connection<Pool, Debug>;
 
-    [[nodiscard]] auto& front()
+    static auto thread_init() -> void
     {
-      return _data[_tail];
     }
 
-    auto pop_front() -> void
+    static auto is_alive(handle_t& handle) -> bool
     {
-      if ((_head != _tail) or not empty())
-      {
-        increment(_tail);
-        --_size;
-      }
-    }
-
-    auto push_back(detail::unique_connection_ptr t)
-    {
-      if (_data.empty())
-        return;
-      _data[_head] = std::move(t);
-      if ((_head != _tail) or empty())
-      {
-        increment(_head);
-        ++_size;
-      }
-      else  // (head == tail) and not empty()
-      {
-        increment(_head);
-        _tail = _head;
-      }
+      return detail::is_alive(handle.connection.get());
     }
   };
 }  // namespace sqlpp::sqlite3::detail
@@ -93,50 +53,5 @@ namespace sqlpp::sqlite3::detail
 namespace sqlpp::sqlite3
 {
   template <::sqlpp::debug Debug>
-  class connection_pool_t
-  {
-    connection_config_t _connection_config;
-    detail::circular_connection_buffer_t _handles;
-    std::mutex _mutex;
-
-    using _connection_t = ::sqlpp::sqlite3::base_connection<connection_pool_t, Debug>;
-    friend _connection_t;
-
-  public:
-    connection_pool_t() = delete;
-    connection_pool_t(std::size_t capacity, connection_config_t connection_config)
-        : _connection_config(std::move(connection_config)), _handles(capacity)
-    {
-    }
-    connection_pool_t(const connection_pool_t&) = delete;
-    connection_pool_t(connection_pool_t&&) = default;
-    connection_pool_t& operator=(const connection_pool_t&) = delete;
-    connection_pool_t& operator=(connection_pool_t&&) = default;
-    ~connection_pool_t() = default;
-
-    [[nodiscard]] auto get() -> _connection_t
-    {
-      const auto lock = std::scoped_lock{_mutex};
-
-      auto handle = [this]() {
-        if (_handles.empty())
-          return detail::unique_connection_ptr{};
-
-        auto handle = detail::unique_connection_ptr(std::move(_handles.front()));
-        _handles.pop_front();
-        return handle;
-      }();
-
-      return handle ? _connection_t{_connection_config, std::move(handle), this}
-                    : _connection_t{_connection_config, this};
-    }
-
-  private:
-    auto put(detail::unique_connection_ptr handle) -> void
-    {
-      const auto lock = std::scoped_lock{_mutex};
-      _handles.push_back(std::move(handle));
-    }
-  };
-
+  using connection_pool_t = ::sqlpp::connection_pool_t<detail::pool_traits, Debug>;
 }  // namespace sqlpp::sqlite3
@@ -0,0 +1,283 @@
+#pragma once
+
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef SQLPP_USE_SQLCIPHER
+#include <sqlcipher/sqlite3.h>
+#else
+#include <sqlite3.h>
+#endif
+
+#include <sqlpp17/core/exception.h>
+#include <sqlpp17/core/transaction.h>
+
+#include <sqlpp17/sqlite3/connection.h>
+#include <sqlpp17/sqlite3/connection_config.h>
+
+// Group commit for many small write transactions
+//
+// Threads submit closures, which take a connection. A single writer thread runs the queued closures in one
+// transaction and commits once, so that many closures share one fsync. Each closure runs in a savepoint: if it throws,
+// only its changes are rolled back and its future receives the exception. The futures of the other closures are
+// completed once the transaction has been committed (or receive the error of the commit).
+//
+// Closures must not start or end transactions themselves. Closures that are queued when the executor is destroyed
+// are still run and committed.
+
+namespace sqlpp::sqlite3
+{
+  struct group_commit_config_t
+  {
+    std::size_t max_batch_size = 256;        // closures per transaction
+    std::chrono::microseconds max_delay{0};  // how long to wait for more closures before committing a smaller batch
+  };
+
+  struct group_commit_metrics_t
+  {
+    std::int64_t batches = 0;          // committed transactions
+    std::int64_t closures = 0;         // closures that have been committed
+    std::int64_t failed_closures = 0;  // closures that threw
+    std::int64_t failed_batches = 0;   // transactions that could not begin or commit
+    std::size_t max_batch_size = 0;
+  };
+
+  class group_commit_t
+  {
+  public:
+    using connection_type = connection_t<::sqlpp::debug::none>;
+
+  private:
+    struct task_base_t
+    {
+      virtual ~task_base_t() = default;
+      virtual auto run(connection_type& connection) -> void = 0;
+      virtual auto complete(std::exception_ptr error) -> void = 0;
+    };
+
+    template <typename Function, typename Result>
+    struct task_t : task_base_t
+    {
+      Function _function;
+      std::promise<Result> _promise;
+      std::optional<std::conditional_t<std::is_void_v<Result>, bool, Result>> _result;
+
+      explicit task_t(Function function) : _function(std::move(function))
+      {
+      }
+
+      auto run(connection_type& connection) -> void override
+      {
+        if constexpr (std::is_void_v<Result>)
+        {
+          _function(connection);
+          _result = true;
+        }
+        else
+        {
+          _result = _function(connection);
+        }
+      }
+
+      auto complete(std::exception_ptr error) -> void override
+      {
+        if (error)
+          _promise.set_exception(error);
+        else if constexpr (std::is_void_v<Result>)
+          _promise.set_value();
+        else
+          _promise.set_value(std::move(*_result));
+      }
+    };
+
+    group_commit_config_t _config;
+    connection_type _connection;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _condition;
+    std::deque<std::unique_ptr<task_base_t>> _queue;
+    bool _stop = false;
+    group_commit_metrics_t _metrics;
+
+    std::thread _thread;
+
+    auto execute(const char* sql) -> void
+    {
+      if (const auto rc = sqlite3_exec(_connection.get(), sql, nullptr, nullptr, nullptr); rc != SQLITE_OK)
+      {
+        detail::throw_step_error(rc, std::string("Sqlite3: Group commit: ") + sql + ": ");
+      }
+    }
+
+    auto run_batch(std::vector<std::unique_ptr<task_base_t>>& tasks) -> void
+    {
+      auto errors = std::vector<std::exception_ptr>(tasks.size());
+      auto batch_error = std::exception_ptr{};
+
+      try
+      {
+        auto options = ::sqlpp::transaction_options_t{};
+        options.lock = ::sqlpp::transaction_lock::immediate;
+        auto transaction = start_transaction(_connection, options);
+
+        for (std::size_t i = 0; i < tasks.size(); ++i)
+        {
+          execute("SAVEPOINT group_commit");
+          try
+          {
+            tasks[i]->run(_connection);
+          }
+          catch (...)
+          {
+            errors[i] = std::current_exception();
+            execute("ROLLBACK TO group_commit");
+          }
+          execute("RELEASE group_commit");
+        }
+
+        transaction.commit();
+      }
+      catch (...)
+      {
+        batch_error = std::current_exception();
+      }
+
+      const auto failed_closures = std::count_if(errors.begin(), errors.end(), [](const auto& e) { return bool(e); });
+      {
+        const auto lock = std::scoped_lock{_mutex};
+        _metrics.failed_closures += failed_closures;
+        if (batch_error)
+        {
+          ++_metrics.failed_batches;
+        }
+        else
+        {
+          ++_metrics.batches;
+          _metrics.closures += static_cast<std::int64_t>(tasks.size()) - failed_closures;
+        }
+        _metrics.max_batch_size = std::max(_metrics.max_batch_size, tasks.size());
+      }
+
+      // Metrics are up to date when the futures become ready
+      for (std::size_t i = 0; i < tasks.size(); ++i)
+      {
+        tasks[i]->complete(errors[i] ? errors[i] : batch_error);
+      }
+    }
+
+    auto run() -> void
+    {
+      auto lock = std::unique_lock{_mutex};
+      while (true)
+      {
+        _condition.wait(lock, [this]() { return _stop or not _queue.empty(); });
+        if (_queue.empty())
+          break;  // stopped
+
+        if (_config.max_delay.count() > 0 and not _stop and _queue.size() < _config.max_batch_size)
+        {
+          _condition.wait_for(lock, _config.max_delay,
+                              [this]() { return _stop or _queue.size() >= _config.max_batch_size; });
+        }
+
+        auto tasks = std::vector<std::unique_ptr<task_base_t>>{};
+        const auto count = std::min(_queue.size(), std::max(_config.max_batch_size, std::size_t{1}));
+        tasks.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          tasks.push_back(std::move(_queue.front()));
+          _queue.pop_front();
+        }
+
+        lock.unlock();
+        run_batch(tasks);
+        tasks.clear();
+        lock.lock();
+      }
+    }
+
+  public:
+    group_commit_t(const connection_config_t& connection_config, group_commit_config_t config = {})
+        : _config(config), _connection(connection_config)
+    {
+      _thread = std::thread{[this]() { run(); }};
+    }
+
+    group_commit_t(const group_commit_t&) = delete;
+    group_commit_t(group_commit_t&&) = delete;
+    group_commit_t& operator=(const group_commit_t&) = delete;
+    group_commit_t& operator=(group_commit_t&&) = delete;
+
+    // Runs and commits the closures that are still queued
+    ~group_commit_t()
+    {
+      {
+        const auto lock = std::scoped_lock{_mutex};
+        _stop = true;
+      }
+      _condition.notify_one();
+      _thread.join();
+    }
+
+    // Queues function(connection) for the next transaction. The future becomes ready after the transaction has been
+    // committed.
+    template <typename Function>
+    [[nodiscard]] auto submit(Function function)
+    {
+      using _result_t = std::invoke_result_t<Function&, connection_type&>;
+      auto task = std::make_unique<task_t<Function, _result_t>>(std::move(function));
+      auto future = task->_promise.get_future();
+      {
+        const auto lock = std::scoped_lock{_mutex};
+        _queue.push_back(std::move(task));
+      }
+      _condition.notify_one();
+      return future;
+    }
+
+    [[nodiscard]] auto metrics() const -> group_commit_metrics_t
+    {
+      const auto lock = std::scoped_lock{_mutex};
+      return _metrics;
+    }
+  };
+}  // namespace sqlpp::sqlite3
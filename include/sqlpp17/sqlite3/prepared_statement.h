@@ -37,12 +37,20 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <sqlite3.h>
 #endif
 
+#include <sqlpp17/core/blob_view.h>
 #include <sqlpp17/core/prepared_statement_parameters.h>
+#include <sqlpp17/core/statement_cache.h>
+#include <sqlpp17/core/transaction.h>
 
 #include <sqlpp17/sqlite3/prepared_statement_result.h>
+#include <sqlpp17/sqlite3/statement_stats.h>
+#include <sqlpp17/sqlite3/statement_timeout.h>
 
 namespace sqlpp::sqlite3::detail
 {
+  using statement_cache_t = ::sqlpp::detail::statement_cache_t<unique_prepared_statement_ptr>;
+  using statement_cache_ref_t = ::sqlpp::detail::statement_cache_ref_t<unique_prepared_statement_ptr>;
+
   inline void check_bind_result(int result, const char* const type)
   {
     switch (result)
@@ -113,6 +121,15 @@ namespace sqlpp::sqlite3
     detail::check_bind_result(result, "string_view");
   }
 
+  inline auto bind_parameter(::sqlite3_stmt* statement, ::sqlpp::blob_view& value, int index) -> void
+  {
+    // A nullptr would be bound as NULL
+    const auto result =
+        value.data() ? sqlite3_bind_blob64(statement, index, value.data(), value.size(), SQLITE_STATIC)
+                     : sqlite3_bind_zeroblob(statement, index, 0);
+    detail::check_bind_result(result, "blob");
+  }
+
   template <typename T>
   auto bind_parameter(::sqlite3_stmt* statement, std::optional<T>& value, int index) -> void
   {
@@ -133,6 +150,11 @@ namespace sqlpp::sqlite3
     detail::unique_prepared_statement_ptr _handle;
     detail::result_owns_statement _ownership;
     ::sqlite3* _connection;
+    detail::statement_timeout_t* _statement_timeout = nullptr;
+    statement_stats_t* _statement_stats = nullptr;
+    ::sqlpp::detail::pending_begin_t* _pending_begin = nullptr;
+    detail::statement_cache_ref_t _statement_cache;  // prepared statements only
+    std::string _cache_key;
 
   public:
     ::sqlpp::prepared_statement_parameters<ParameterVector> parameters = {};
@@ -143,8 +165,22 @@ namespace sqlpp::sqlite3
     prepared_statement_t(const Connection& connection,
                          const std::string& sql_string,
                          detail::result_owns_statement ownership)
-        : _ownership(ownership), _connection(connection.get())
+        : _ownership(ownership),
+          _connection(connection.get()),
+          _statement_timeout(connection.get_statement_timeout_state()),
+          _statement_stats(connection.get_statement_stats_state()),
+          _pending_begin(connection.get_pending_begin_state())
     {
+      // Statements that results do not own are kept by the connection for reuse
+      if (auto* cache = connection.get_statement_cache();
+          ownership == detail::result_owns_statement{false} and cache and cache->enabled())
+      {
+        _statement_cache = detail::statement_cache_ref_t{cache};
+        _cache_key = sql_string;
+        if (_handle = cache->take(sql_string); _handle)
+          return;
+      }
+
       ::sqlite3_stmt* statement_ptr = nullptr;
 
       const auto rc = sqlite3_prepare_v2(connection.get(), sql_string.c_str(), static_cast<int>(sql_string.size()),
@@ -154,9 +190,10 @@ namespace sqlpp::sqlite3
 
       if (rc != SQLITE_OK)
       {
-        throw sqlpp::exception(
+        throw sqlpp::database_exception(
             "Sqlite3: Could not prepare statement: " + std::string(sqlite3_errmsg(connection.get())) +
-            " (statement was >>" + sql_string + "<<)\n");
+                " (statement was >>" + sql_string + "<<)\n",
+            detail::error_code_of(rc), rc);
       }
     }
 
@@ -172,20 +209,52 @@ namespace sqlpp::sqlite3
     prepared_statement_t(prepared_statement_t&& rhs) = default;
     prepared_statement_t& operator=(const prepared_statement_t&) = delete;
     prepared_statement_t& operator=(prepared_statement_t&&) = default;
-    ~prepared_statement_t() = default;
+    ~prepared_statement_t()
+    {
+      // Once the connection object is gone, the statement is finalized instead. The handle might be used by another
+      // thread by now, which sqlite3 serializes (or it has been closed, then finalizing releases the zombie handle).
+      if (auto* cache = _statement_cache.get(); cache and _handle)
+      {
+        sqlite3_reset(_handle.get());
+        sqlite3_clear_bindings(_handle.get());
+        cache->put(std::move(_cache_key), std::move(_handle));
+      }
+    }
 
     auto execute()
     {
-      if (const auto rc = sqlite3_reset(_handle.get()); rc != SQLITE_OK)
+      // sqlite3_reset() repeats the error of the previous step (e.g. after a cancelled statement), which has been
+      // reported already. The statement is reset anyway.
+      sqlite3_reset(_handle.get());
+
+      ::sqlpp::sqlite3::bind_parameters(_handle.get(), parameters);
+
+      // First statement of a lazy transaction
+      if (_pending_begin and _pending_begin->has_value())
       {
-        throw sqlpp::exception("Sqlite3: Could not reset statement: " + std::string(sqlite3_errmsg(_connection)));
+        if (const auto rc = sqlite3_exec(_connection, _pending_begin->value().c_str(), nullptr, nullptr, nullptr);
+            rc != SQLITE_OK)
+        {
+          detail::throw_step_error(rc, "Sqlite3: Could not begin transaction: ");  // still pending
+        }
+        _pending_begin->reset();
       }
 
-      ::sqlpp::sqlite3::bind_parameters(_handle.get(), parameters);
+      if (_statement_timeout)
+      {
+        _statement_timeout->arm();
+      }
+
+      if (_statement_stats)
+      {
+        // Counters are cumulative, let them start at zero for each execution
+        read_statement_stats(_handle.get(), true);
+      }
 
       if constexpr (not std::is_same_v<ResultType, select_result>)
       {
-        switch (const auto rc = sqlite3_step(_handle.get()); rc)
+        const auto rc = _statement_timeout ? _statement_timeout->step(_handle.get()) : sqlite3_step(_handle.get());
+        switch (rc)
         {
           case SQLITE_OK:
             [[fallthrough]];
@@ -194,7 +263,12 @@ namespace sqlpp::sqlite3
           case SQLITE_DONE:
             break;
           default:
-            throw sqlpp::exception("Sqlite3: Could not execute statement: " + std::string(sqlite3_errstr(rc)));
+            detail::throw_step_error(rc, "Sqlite3: Could not execute statement: ");
+        }
+
+        if (_statement_stats)
+        {
+          *_statement_stats = read_statement_stats(_handle.get());
         }
       }
 
@@ -214,8 +288,8 @@ namespace sqlpp::sqlite3
       {
         return ::sqlpp::result_t<prepared_statement_result_t<ResultRow>>{
             (_ownership == (detail::result_owns_statement{true}))
-                ? detail::unique_prepared_statement_ptr{_handle.release(), {true}}
-                : detail::unique_prepared_statement_ptr{_handle.get(), {false}}};
+                ? detail::unique_prepared_statement_ptr{_handle.release(), {true, _statement_stats, _statement_timeout}}
+                : detail::unique_prepared_statement_ptr{_handle.get(), {false, _statement_stats, _statement_timeout}}};
       }
       else if constexpr (std::is_same_v<ResultType, execute_result>)
       {
@@ -227,6 +301,12 @@ namespace sqlpp::sqlite3
       }
     }
 
+    // Engine counters of the most recent execution(s), see statement_stats_t
+    [[nodiscard]] auto stats(bool reset = false) const -> statement_stats_t
+    {
+      return read_statement_stats(_handle.get(), reset);
+    }
+
     auto* get() const
     {
       return _handle.get();
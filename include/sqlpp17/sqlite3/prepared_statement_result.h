@@ -29,7 +29,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <functional>
 #include <memory>
 #include <optional>
+#include <string>
 #include <string_view>
+#include <vector>
 
 #ifdef SQLPP_USE_SQLCIPHER
 #include <sqlcipher/sqlite3.h>
@@ -37,7 +39,14 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <sqlite3.h>
 #endif
 
+#include <sqlpp17/core/blob_view.h>
+#include <sqlpp17/core/column_batch.h>
+#include <sqlpp17/core/exception.h>
 #include <sqlpp17/core/result_row.h>
+#include <sqlpp17/core/row_arena.h>
+
+#include <sqlpp17/sqlite3/statement_stats.h>
+#include <sqlpp17/sqlite3/statement_timeout.h>
 
 namespace sqlpp::sqlite3::detail
 {
@@ -48,9 +57,15 @@ namespace sqlpp::sqlite3::detail
   struct prepared_statement_cleanup_t
   {
     bool _owning;
+    statement_stats_t* _statement_stats = nullptr;  // receives the stats of the statement, if not null
+    statement_timeout_t* _statement_timeout = nullptr;  // limits the time spent in steps, if not null
 
     auto operator()(::sqlite3_stmt* handle) const noexcept -> void
     {
+      if (_statement_stats and handle)
+      {
+        *_statement_stats = read_statement_stats(handle);
+      }
       if (_owning and handle)
       {
         sqlite3_finalize(handle);
@@ -59,9 +74,38 @@ namespace sqlpp::sqlite3::detail
   };
   using unique_prepared_statement_ptr = std::unique_ptr<::sqlite3_stmt, detail::prepared_statement_cleanup_t>;
 
-  inline auto get_next_result_row(::sqlite3_stmt* stmt) -> bool
+  inline auto error_code_of(int rc) -> ::sqlpp::error_code
+  {
+    switch (rc & 0xff)  // primary result code
+    {
+      case SQLITE_BUSY:
+        return ::sqlpp::error_code::busy;
+      case SQLITE_LOCKED:
+        return ::sqlpp::error_code::locked;
+      case SQLITE_CANTOPEN:
+        [[fallthrough]];
+      case SQLITE_IOERR:
+        [[fallthrough]];
+      case SQLITE_NOTADB:
+        return ::sqlpp::error_code::connection_failure;
+      default:
+        return ::sqlpp::error_code::unknown;
+    }
+  }
+
+  [[noreturn]] inline auto throw_step_error(int rc, const std::string& message) -> void
+  {
+    if (rc == SQLITE_INTERRUPT)
+    {
+      throw sqlpp::cancelled_exception(message + std::string(sqlite3_errstr(rc)));
+    }
+    throw sqlpp::database_exception(message + std::string(sqlite3_errstr(rc)), error_code_of(rc), rc);
+  }
+
+  inline auto get_next_result_row(const unique_prepared_statement_ptr& handle) -> bool
   {
-    auto rc = sqlite3_step(stmt);
+    auto* timeout = handle.get_deleter()._statement_timeout;
+    auto rc = timeout ? timeout->step(handle.get()) : sqlite3_step(handle.get());
 
     switch (rc)
     {
@@ -70,8 +114,7 @@ namespace sqlpp::sqlite3::detail
       case SQLITE_DONE:
         return false;
       default:
-        throw sqlpp::exception("Sqlite3 error: Unexpected return value for sqlite3_step(): " +
-                               std::string(sqlite3_errstr(rc)));
+        throw_step_error(rc, "Sqlite3 error: Unexpected return value for sqlite3_step(): ");
     }
   }
 }  // namespace sqlpp::sqlite3::detail
@@ -110,6 +153,25 @@ namespace sqlpp::sqlite3
                              static_cast<std::size_t>(sqlite3_column_bytes(stmt, index))};
   }
 
+  inline auto assign_field(sqlite3_stmt* stmt, ::sqlpp::blob_view& value, int index) -> void
+  {
+    value = ::sqlpp::blob_view{sqlite3_column_blob(stmt, index),
+                               static_cast<std::size_t>(sqlite3_column_bytes(stmt, index))};
+  }
+
+  // For members of user-defined structs
+  inline auto assign_field(sqlite3_stmt* stmt, std::string& value, int index) -> void
+  {
+    value.assign(reinterpret_cast<const char*>(sqlite3_column_text(stmt, index)),
+                 static_cast<std::size_t>(sqlite3_column_bytes(stmt, index)));
+  }
+
+  inline auto assign_field(sqlite3_stmt* stmt, std::vector<std::byte>& value, int index) -> void
+  {
+    const auto* data = static_cast<const std::byte*>(sqlite3_column_blob(stmt, index));
+    value.assign(data, data + sqlite3_column_bytes(stmt, index));
+  }
+
   template <typename T>
   auto assign_field(sqlite3_stmt* stmt, std::optional<T>& value, int index) -> void
   {
@@ -131,6 +193,36 @@ namespace sqlpp::sqlite3
     (..., assign_field(stmt, static_cast<result_column_base<ColumnSpecs>&>(row)(), Is));
   }
 
+  template <typename... ColumnSpecs, typename Struct, unsigned... Is>
+  auto assign_members(sqlite3_stmt* stmt, Struct& s, std::integer_sequence<unsigned, Is...>) -> void
+  {
+    (..., assign_field(stmt, get_member<ColumnSpecs>(s), Is));
+  }
+
+  template <typename Column>
+  auto append_field(sqlite3_stmt* stmt, Column& column, int index) -> void
+  {
+    if constexpr (Column::can_be_null)
+    {
+      if (sqlite3_column_type(stmt, index) == SQLITE_NULL)
+      {
+        column.push_null();
+        return;
+      }
+    }
+    auto value = typename Column::value_type{};
+    assign_field(stmt, value, index);
+    column.push_back(value);
+  }
+
+  template <typename... ColumnSpecs, unsigned... Is>
+  auto append_fields(sqlite3_stmt* stmt,
+                     column_batch_t<result_row_t<ColumnSpecs...>>& batch,
+                     std::integer_sequence<unsigned, Is...>) -> void
+  {
+    (..., append_field(stmt, static_cast<batch_column_base<ColumnSpecs>&>(batch)(), Is));
+  }
+
   template <typename ResultRow>
   class prepared_statement_result_t
   {
@@ -161,7 +253,7 @@ namespace sqlpp::sqlite3
 
     auto get_next_row() -> void
     {
-      if (detail::get_next_result_row(_handle.get()))
+      if (detail::get_next_result_row(_handle))
       {
         assign_fields(_handle.get(), _row, std::make_integer_sequence<unsigned, sizeof...(ColumnSpecs)>{});
       }
@@ -171,6 +263,55 @@ namespace sqlpp::sqlite3
       }
     }
 
+    // Steps through up to max_rows rows, appending their fields straight to the columns
+    auto fetch_columns(column_batch_t<row_type>& batch, std::size_t max_rows) -> void
+    {
+      for (std::size_t count = 0; count < max_rows and _handle; ++count)
+      {
+        if (detail::get_next_result_row(_handle))
+        {
+          append_fields(_handle.get(), batch, std::make_integer_sequence<unsigned, sizeof...(ColumnSpecs)>{});
+        }
+        else
+        {
+          reset();
+        }
+      }
+    }
+
+    template <typename Struct>
+    auto get_next_row_into(Struct& s) -> bool
+    {
+      if (_handle and detail::get_next_result_row(_handle))
+      {
+        assign_members<ColumnSpecs...>(_handle.get(), s,
+                                       std::make_integer_sequence<unsigned, sizeof...(ColumnSpecs)>{});
+        return true;
+      }
+      reset();
+      return false;
+    }
+
+    // Decodes straight into the caller's rows
+    auto fetch_into(row_type* rows, std::size_t count, std::pmr::memory_resource& arena) -> std::size_t
+    {
+      auto fetched = std::size_t{0};
+      while (fetched < count and _handle)
+      {
+        if (detail::get_next_result_row(_handle))
+        {
+          assign_fields(_handle.get(), rows[fetched], std::make_integer_sequence<unsigned, sizeof...(ColumnSpecs)>{});
+          copy_fields_to_arena(rows[fetched], arena);
+          ++fetched;
+        }
+        else
+        {
+          reset();
+        }
+      }
+      return fetched;
+    }
+
     [[nodiscard]] auto& row() const
     {
       return _row;
@@ -0,0 +1,89 @@
+#pragma once
+
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef SQLPP_USE_SQLCIPHER
+#include <sqlcipher/sqlite3.h>
+#else
+#include <sqlite3.h>
+#endif
+
+namespace sqlpp::sqlite3
+{
+  // Counters reported by sqlite3_stmt_status
+  struct statement_stats_t
+  {
+    int fullscan_steps = 0;  // steps in full table scans, a high count hints at a missing index
+    int sorts = 0;           // sort operations, a non-zero count hints at a missing index for ORDER BY
+    int autoindexes = 0;     // rows inserted into automatic indexes
+    int vm_steps = 0;        // virtual machine operations
+    int memory_used = 0;     // bytes of heap used by the statement
+  };
+
+  // Page cache counters reported by sqlite3_db_status
+  struct cache_stats_t
+  {
+    int hits = 0;
+    int misses = 0;
+    int writes = 0;
+    int spills = 0;
+    int used_bytes = 0;
+  };
+
+  // If reset is true, the counters are set to zero after reading (memory_used is not a counter and is never reset)
+  inline auto read_statement_stats(::sqlite3_stmt* statement, bool reset = false) -> statement_stats_t
+  {
+    const auto read = [statement, reset](int op) { return sqlite3_stmt_status(statement, op, reset); };
+
+    auto stats = statement_stats_t{};
+    stats.fullscan_steps = read(SQLITE_STMTSTATUS_FULLSCAN_STEP);
+    stats.sorts = read(SQLITE_STMTSTATUS_SORT);
+    stats.autoindexes = read(SQLITE_STMTSTATUS_AUTOINDEX);
+    stats.vm_steps = read(SQLITE_STMTSTATUS_VM_STEP);
+    stats.memory_used = sqlite3_stmt_status(statement, SQLITE_STMTSTATUS_MEMUSED, false);
+    return stats;
+  }
+
+  // If reset is true, the hit/miss/write/spill counters are set to zero after reading
+  inline auto read_cache_stats(::sqlite3* connection, bool reset = false) -> cache_stats_t
+  {
+    const auto read = [connection, reset](int op) {
+      int current = 0;
+      int highwater = 0;
+      sqlite3_db_status(connection, op, &current, &highwater, reset);
+      return current;
+    };
+
+    auto stats = cache_stats_t{};
+    stats.hits = read(SQLITE_DBSTATUS_CACHE_HIT);
+    stats.misses = read(SQLITE_DBSTATUS_CACHE_MISS);
+    stats.writes = read(SQLITE_DBSTATUS_CACHE_WRITE);
+    stats.spills = read(SQLITE_DBSTATUS_CACHE_SPILL);
+    stats.used_bytes = read(SQLITE_DBSTATUS_CACHE_USED);
+    return stats;
+  }
+}  // namespace sqlpp::sqlite3
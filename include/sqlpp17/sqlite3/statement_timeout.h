@@ -0,0 +1,136 @@
+#pragma once
+
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>
+#include <chrono>
+
+#ifdef SQLPP_USE_SQLCIPHER
+#include <sqlcipher/sqlite3.h>
+#else
+#include <sqlite3.h>
+#endif
+
+namespace sqlpp::sqlite3::detail
+{
+  // Statement deadlines are checked via the progress handler. The time budget is reset whenever a statement is
+  // executed. Only time spent within sqlite3_step() counts, like server time for PostgreSQL and MySQL, not the time the
+  // caller spends between two rows.
+  class statement_timeout_t
+  {
+    using _clock = std::chrono::steady_clock;
+
+    // Number of virtual machine instructions between two deadline checks
+    static constexpr auto _check_interval = 1000;
+
+    ::sqlite3* _connection = nullptr;
+    std::chrono::milliseconds _timeout{0};
+    _clock::duration _remaining{0};  // of the current statement
+    _clock::time_point _deadline = _clock::time_point::max();  // of the current step
+
+    static auto on_progress(void* self) -> int
+    {
+      return _clock::now() >= static_cast<statement_timeout_t*>(self)->_deadline;
+    }
+
+  public:
+    statement_timeout_t(::sqlite3* connection) : _connection(connection)
+    {
+    }
+    statement_timeout_t(const statement_timeout_t&) = delete;
+    statement_timeout_t(statement_timeout_t&&) = delete;
+    statement_timeout_t& operator=(const statement_timeout_t&) = delete;
+    statement_timeout_t& operator=(statement_timeout_t&&) = delete;
+    ~statement_timeout_t()
+    {
+      // The connection might be returned to a pool and outlive this object
+      if (_timeout.count() > 0)
+        sqlite3_progress_handler(_connection, 0, nullptr, nullptr);
+    }
+
+    auto set(std::chrono::milliseconds timeout) -> void
+    {
+      if (timeout.count() > 0)
+      {
+        sqlite3_progress_handler(_connection, _check_interval, &on_progress, this);
+      }
+      else if (_timeout.count() > 0)
+      {
+        sqlite3_progress_handler(_connection, 0, nullptr, nullptr);
+      }
+      _timeout = timeout;
+      _remaining = timeout;
+      _deadline = _clock::time_point::max();
+    }
+
+    [[nodiscard]] auto get() const
+    {
+      return _timeout;
+    }
+
+    auto arm() -> void
+    {
+      _remaining = _timeout;
+    }
+
+    // Steps the statement within the remaining time
+    auto step(::sqlite3_stmt* statement) -> int
+    {
+      if (_timeout.count() <= 0)
+        return sqlite3_step(statement);
+
+      const auto start = _clock::now();
+      _deadline = start + _remaining;
+      const auto rc = sqlite3_step(statement);
+      _deadline = _clock::time_point::max();
+      _remaining -= std::min(_remaining, _clock::now() - start);
+      return rc;
+    }
+  };
+}  // namespace sqlpp::sqlite3::detail
+
+namespace sqlpp::sqlite3
+{
+  // Allows to cancel the statement that is currently executed by a connection, e.g. from another thread.
+  // The handle must not be used after the connection has been closed.
+  class cancel_handle_t
+  {
+    ::sqlite3* _connection;
+
+  public:
+    explicit cancel_handle_t(::sqlite3* connection) : _connection(connection)
+    {
+    }
+
+    // Interrupts running statements, which then fail with a sqlpp::cancelled_exception
+    auto cancel() const -> bool
+    {
+      sqlite3_interrupt(_connection);
+      return true;
+    }
+  };
+}  // namespace sqlpp::sqlite3
@@ -28,6 +28,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <string>
 
+#include <sqlpp17/core/data_types.h>
 #include <sqlpp17/core/value_type_to_sql_string.h>
 
 namespace sqlpp::sqlite3
@@ -74,4 +75,9 @@ namespace sqlpp
     return " TEXT";
   }
 
+  [[nodiscard]] inline auto value_type_to_sql_string(::sqlpp::sqlite3::context_t&, type_t<::sqlpp::blob>)
+  {
+    return " BLOB";
+  }
+
 }  // namespace sqlpp
@@ -0,0 +1,567 @@
+#pragma once
+
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#ifdef SQLPP_USE_SQLCIPHER
+#include <sqlcipher/sqlite3.h>
+#else
+#include <sqlite3.h>
+#endif
+
+#include <sqlpp17/core/detail/first.h>
+#include <sqlpp17/core/exception.h>
+#include <sqlpp17/core/member.h>
+#include <sqlpp17/core/table.h>
+#include <sqlpp17/core/to_sql_name.h>
+#include <sqlpp17/core/type_vector.h>
+
+#include <sqlpp17/sqlite3/context.h>
+#include <sqlpp17/sqlite3/value_type_to_sql_string.h>
+
+// Read-only virtual tables over C++ containers.
+//
+// The table is described by a regular table spec (as used for table_t), the rows are structs that have one member per
+// column, named like the C++ names of the columns. Registering a container makes the table available under its SQL name
+// as an eponymous virtual table, i.e. it can be used in from() and join() like any other table without CREATE TABLE or
+// INSERT.
+//
+// Equality constraints on the key column (the first column of the primary key, or the first column if there is no
+// primary key) are answered via a sorted index that is built on first use.
+//
+// The container must not be modified or destroyed while it is registered.
+
+namespace sqlpp::sqlite3::detail
+{
+  inline auto result_field(::sqlite3_context* context, const std::nullopt_t&) -> void
+  {
+    sqlite3_result_null(context);
+  }
+
+  inline auto result_field(::sqlite3_context* context, bool value) -> void
+  {
+    sqlite3_result_int(context, value);
+  }
+
+  inline auto result_field(::sqlite3_context* context, std::int32_t value) -> void
+  {
+    sqlite3_result_int(context, value);
+  }
+
+  inline auto result_field(::sqlite3_context* context, std::int64_t value) -> void
+  {
+    sqlite3_result_int64(context, value);
+  }
+
+  inline auto result_field(::sqlite3_context* context, float value) -> void
+  {
+    sqlite3_result_double(context, value);
+  }
+
+  inline auto result_field(::sqlite3_context* context, double value) -> void
+  {
+    sqlite3_result_double(context, value);
+  }
+
+  inline auto result_field(::sqlite3_context* context, std::string_view value) -> void
+  {
+    // The container outlives the statement, no need to copy
+    sqlite3_result_text(context, value.data(), static_cast<int>(value.size()), SQLITE_STATIC);
+  }
+
+  inline auto result_field(::sqlite3_context* context, const std::string& value) -> void
+  {
+    result_field(context, std::string_view{value});
+  }
+
+  inline auto result_field(::sqlite3_context* context, const char* value) -> void
+  {
+    value ? result_field(context, std::string_view{value}) : result_field(context, std::nullopt);
+  }
+
+  template <typename T>
+  auto result_field(::sqlite3_context* context, const std::optional<T>& value) -> void
+  {
+    value ? result_field(context, *value) : result_field(context, std::nullopt);
+  }
+
+  // Keys are compared in a normalized representation: int64, double or string_view
+  template <typename Field>
+  auto normalized_key(const Field& field)
+  {
+    if constexpr (std::is_integral_v<Field>)
+    {
+      return static_cast<std::int64_t>(field);
+    }
+    else if constexpr (std::is_floating_point_v<Field>)
+    {
+      return static_cast<double>(field);
+    }
+    else
+    {
+      return std::string_view{field};
+    }
+  }
+
+  template <typename Key>
+  auto read_key(::sqlite3_value* value) -> std::optional<Key>
+  {
+    const auto type = sqlite3_value_type(value);
+    if constexpr (std::is_same_v<Key, std::int64_t>)
+    {
+      if (type == SQLITE_INTEGER)
+        return sqlite3_value_int64(value);
+      if (type == SQLITE_FLOAT)
+      {
+        const auto d = sqlite3_value_double(value);
+        if (std::trunc(d) == d and std::abs(d) < 9.0e18)
+          return static_cast<std::int64_t>(d);
+      }
+      return std::nullopt;
+    }
+    else if constexpr (std::is_same_v<Key, double>)
+    {
+      if (type == SQLITE_INTEGER or type == SQLITE_FLOAT)
+        return sqlite3_value_double(value);
+      return std::nullopt;
+    }
+    else
+    {
+      if (type == SQLITE_TEXT)
+        return std::string_view{reinterpret_cast<const char*>(sqlite3_value_text(value)),
+                                static_cast<std::size_t>(sqlite3_value_bytes(value))};
+      return std::nullopt;
+    }
+  }
+
+  template <typename TypeVector>
+  struct first_of;
+
+  template <typename... Ts>
+  struct first_of<::sqlpp::type_vector<Ts...>>
+  {
+    using type = ::sqlpp::detail::first_t<Ts...>;
+  };
+
+  template <typename TableSpec, typename Enable = void>
+  struct key_column_of
+  {
+    using type = typename first_of<typename TableSpec::_columns>::type;
+  };
+
+  template <typename TableSpec>
+  struct key_column_of<TableSpec, std::void_t<typename TableSpec::primary_key>>
+  {
+    using type = typename first_of<typename TableSpec::primary_key>::type;
+  };
+
+  template <typename ColumnSpec, typename... ColumnSpecs>
+  constexpr auto index_of_column(::sqlpp::type_vector<ColumnSpecs...>) -> int
+  {
+    auto index = 0;
+    auto found = -1;
+    (..., (found = (found < 0 and std::is_same_v<ColumnSpec, ColumnSpecs>) ? index : found, ++index));
+    return found;
+  }
+
+  template <typename TableSpec, typename Row>
+  class container_table_data_t
+  {
+    using _key_column = typename key_column_of<TableSpec>::type;
+    using _key_field = ::sqlpp::remove_optional_t<::sqlpp::member_type_of_t<_key_column, const Row>>;
+    using _key_t = decltype(normalized_key(std::declval<const _key_field&>()));
+
+    const Row* _rows;
+    std::size_t _size;
+    std::vector<std::size_t> _index;  // row positions with non-NULL keys, sorted by key
+    bool _is_indexed = false;
+
+    auto key_at(std::size_t pos) const
+    {
+      const auto& field = ::sqlpp::get_member<_key_column>(_rows[pos]);
+      if constexpr (::sqlpp::is_optional_v<std::decay_t<decltype(field)>>)
+      {
+        return normalized_key(*field);
+      }
+      else
+      {
+        return normalized_key(field);
+      }
+    }
+
+    auto has_key_at(std::size_t pos) const -> bool
+    {
+      return ::sqlpp::has_value(::sqlpp::get_member<_key_column>(_rows[pos]));
+    }
+
+    auto build_index() -> void
+    {
+      _index.reserve(_size);
+      for (std::size_t pos = 0; pos < _size; ++pos)
+      {
+        if (has_key_at(pos))
+          _index.push_back(pos);
+      }
+      std::stable_sort(_index.begin(), _index.end(),
+                       [this](std::size_t l, std::size_t r) { return key_at(l) < key_at(r); });
+      _is_indexed = true;
+    }
+
+  public:
+    static constexpr auto key_column_index = index_of_column<_key_column>(typename TableSpec::_columns{});
+    static_assert(key_column_index >= 0, "the key column must be one of the table's columns");
+
+    container_table_data_t(const Row* rows, std::size_t size) : _rows(rows), _size(size)
+    {
+    }
+
+    [[nodiscard]] auto size() const
+    {
+      return _size;
+    }
+
+    [[nodiscard]] auto& operator[](std::size_t pos) const
+    {
+      return _rows[pos];
+    }
+
+    // Returns the range of positions with the given key or nothing if the value cannot be compared to the key
+    [[nodiscard]] auto equal_range(::sqlite3_value* value)
+        -> std::optional<std::pair<const std::size_t*, const std::size_t*>>
+    {
+      const auto key = read_key<_key_t>(value);
+      if (not key)
+        return std::nullopt;
+
+      if (not _is_indexed)
+        build_index();
+
+      const auto [first, last] = std::equal_range(
+          _index.begin(), _index.end(), *key,
+          [this](const auto& l, const auto& r) {
+            if constexpr (std::is_same_v<std::decay_t<decltype(l)>, std::size_t>)
+              return key_at(l) < r;
+            else
+              return l < key_at(r);
+          });
+      return std::pair{_index.data() + (first - _index.begin()), _index.data() + (last - _index.begin())};
+    }
+  };
+
+  template <typename Data>
+  struct container_vtab_t : public ::sqlite3_vtab
+  {
+    Data* _data = nullptr;
+  };
+
+  struct container_cursor_t : public ::sqlite3_vtab_cursor
+  {
+    const std::size_t* _positions = nullptr;  // nullptr for full scans
+    std::size_t _pos = 0;
+    std::size_t _end = 0;
+
+    [[nodiscard]] auto row_position() const
+    {
+      return _positions ? _positions[_pos] : _pos;
+    }
+  };
+
+  template <typename TableSpec, typename Row, typename ColumnVector = typename TableSpec::_columns>
+  struct container_module_t;
+
+  template <typename TableSpec, typename Row, typename... ColumnSpecs>
+  struct container_module_t<TableSpec, Row, ::sqlpp::type_vector<ColumnSpecs...>>
+  {
+    using _data_t = container_table_data_t<TableSpec, Row>;
+    using _vtab_t = container_vtab_t<_data_t>;
+
+    static_assert((true and ... and ::sqlpp::has_member_v<ColumnSpecs, const Row>),
+                  "the row type must have a member for each column of the table spec");
+
+    [[nodiscard]] static auto create_table_string() -> std::string
+    {
+      auto context = ::sqlpp::sqlite3::context_t{};
+      auto ret = std::string{"CREATE TABLE x("};
+      auto first = true;
+      (..., (ret += (first ? "" : ", "), first = false, ret += to_sql_name(context, ColumnSpecs{}),
+             ret += value_type_to_sql_string(context, type_t<typename ColumnSpecs::value_type>{})));
+      ret += ")";
+      return ret;
+    }
+
+    static auto x_connect(::sqlite3* db,
+                          void* aux,
+                          [[maybe_unused]] int argc,
+                          [[maybe_unused]] const char* const* argv,
+                          ::sqlite3_vtab** vtab,
+                          [[maybe_unused]] char** error) -> int
+    {
+      try
+      {
+        if (const auto rc = sqlite3_declare_vtab(db, create_table_string().c_str()); rc != SQLITE_OK)
+          return rc;
+
+        auto* table = new _vtab_t{};
+        table->_data = static_cast<_data_t*>(aux);
+        *vtab = table;
+        return SQLITE_OK;
+      }
+      catch (...)
+      {
+        return SQLITE_NOMEM;
+      }
+    }
+
+    static auto x_disconnect(::sqlite3_vtab* vtab) -> int
+    {
+      delete static_cast<_vtab_t*>(vtab);
+      return SQLITE_OK;
+    }
+
+    static auto x_best_index(::sqlite3_vtab* vtab, ::sqlite3_index_info* info) -> int
+    {
+      const auto size = static_cast<double>(static_cast<_vtab_t*>(vtab)->_data->size());
+
+      for (auto i = 0; i < info->nConstraint; ++i)
+      {
+        const auto& constraint = info->aConstraint[i];
+        if (constraint.usable and constraint.iColumn == _data_t::key_column_index and
+            constraint.op == SQLITE_INDEX_CONSTRAINT_EQ)
+        {
+          // Not omitting the check lets sqlite3 handle values that are not comparable to the key
+          info->aConstraintUsage[i].argvIndex = 1;
+          info->aConstraintUsage[i].omit = 0;
+          info->idxNum = 1;
+          info->estimatedCost = std::log2(size + 1) + 1;
+          info->estimatedRows = 1;
+          return SQLITE_OK;
+        }
+      }
+
+      info->idxNum = 0;
+      info->estimatedCost = size + 1;
+      info->estimatedRows = static_cast<sqlite3_int64>(size);
+      return SQLITE_OK;
+    }
+
+    static auto x_open([[maybe_unused]] ::sqlite3_vtab* vtab, ::sqlite3_vtab_cursor** cursor) -> int
+    {
+      try
+      {
+        *cursor = new container_cursor_t{};
+        return SQLITE_OK;
+      }
+      catch (...)
+      {
+        return SQLITE_NOMEM;
+      }
+    }
+
+    static auto x_close(::sqlite3_vtab_cursor* cursor) -> int
+    {
+      delete static_cast<container_cursor_t*>(cursor);
+      return SQLITE_OK;
+    }
+
+    static auto x_filter(::sqlite3_vtab_cursor* base,
+                         int index_number,
+                         [[maybe_unused]] const char* index_string,
+                         int argc,
+                         ::sqlite3_value** argv) -> int
+    {
+      auto* cursor = static_cast<container_cursor_t*>(base);
+      auto* data = static_cast<_vtab_t*>(base->pVtab)->_data;
+
+      try
+      {
+        if (index_number == 1 and argc == 1)
+        {
+          if (const auto range = data->equal_range(argv[0]))
+          {
+            cursor->_positions = range->first;
+            cursor->_pos = 0;
+            cursor->_end = static_cast<std::size_t>(range->second - range->first);
+            return SQLITE_OK;
+          }
+        }
+      }
+      catch (...)
+      {
+        return SQLITE_NOMEM;
+      }
+
+      cursor->_positions = nullptr;
+      cursor->_pos = 0;
+      cursor->_end = data->size();
+      return SQLITE_OK;
+    }
+
+    static auto x_next(::sqlite3_vtab_cursor* base) -> int
+    {
+      ++static_cast<container_cursor_t*>(base)->_pos;
+      return SQLITE_OK;
+    }
+
+    static auto x_eof(::sqlite3_vtab_cursor* base) -> int
+    {
+      const auto* cursor = static_cast<container_cursor_t*>(base);
+      return cursor->_pos >= cursor->_end;
+    }
+
+    template <std::size_t... Is>
+    static auto result_column(::sqlite3_context* context, const Row& row, int column, std::index_sequence<Is...>)
+        -> void
+    {
+      (..., (column == static_cast<int>(Is) ? result_field(context, ::sqlpp::get_member<ColumnSpecs>(row)) : void()));
+    }
+
+    static auto x_column(::sqlite3_vtab_cursor* base, ::sqlite3_context* context, int column) -> int
+    {
+      const auto* cursor = static_cast<container_cursor_t*>(base);
+      const auto& row = (*static_cast<_vtab_t*>(base->pVtab)->_data)[cursor->row_position()];
+      result_column(context, row, column, std::index_sequence_for<ColumnSpecs...>{});
+      return SQLITE_OK;
+    }
+
+    static auto x_rowid(::sqlite3_vtab_cursor* base, ::sqlite3_int64* rowid) -> int
+    {
+      *rowid = static_cast<::sqlite3_int64>(static_cast<container_cursor_t*>(base)->row_position());
+      return SQLITE_OK;
+    }
+
+    static auto destroy_data(void* data) -> void
+    {
+      delete static_cast<_data_t*>(data);
+    }
+
+    [[nodiscard]] static auto make_module()
+    {
+      auto module = ::sqlite3_module{};
+      module.iVersion = 1;
+      module.xCreate = nullptr;  // eponymous-only
+      module.xConnect = &x_connect;
+      module.xBestIndex = &x_best_index;
+      module.xDisconnect = &x_disconnect;
+      module.xDestroy = &x_disconnect;
+      module.xOpen = &x_open;
+      module.xClose = &x_close;
+      module.xFilter = &x_filter;
+      module.xNext = &x_next;
+      module.xEof = &x_eof;
+      module.xColumn = &x_column;
+      module.xRowid = &x_rowid;
+      return module;
+    }
+
+    inline static const ::sqlite3_module module = make_module();
+  };
+}  // namespace sqlpp::sqlite3::detail
+
+namespace sqlpp::sqlite3
+{
+  // Keeps a container registered as a virtual table. The registration ends with the destruction of this object.
+  class container_table_t
+  {
+    ::sqlite3* _connection = nullptr;
+    std::string _name;
+
+  public:
+    container_table_t() = default;
+    container_table_t(::sqlite3* connection, std::string name) : _connection(connection), _name(std::move(name))
+    {
+    }
+    container_table_t(const container_table_t&) = delete;
+    container_table_t(container_table_t&& rhs)
+        : _connection(std::exchange(rhs._connection, nullptr)), _name(std::move(rhs._name))
+    {
+    }
+    container_table_t& operator=(const container_table_t&) = delete;
+    container_table_t& operator=(container_table_t&& rhs)
+    {
+      if (this != &rhs)
+      {
+        reset();
+        _connection = std::exchange(rhs._connection, nullptr);
+        _name = std::move(rhs._name);
+      }
+      return *this;
+    }
+    ~container_table_t()
+    {
+      reset();
+    }
+
+    auto reset() -> void
+    {
+      if (_connection)
+      {
+        // Dropping the module also destroys the data that was handed to sqlite3_create_module_v2
+        sqlite3_create_module_v2(_connection, _name.c_str(), nullptr, nullptr, nullptr);
+        _connection = nullptr;
+      }
+    }
+
+    [[nodiscard]] auto& name() const
+    {
+      return _name;
+    }
+  };
+
+  template <typename Connection, typename TableSpec, typename Range>
+  [[nodiscard]] auto register_container_table(Connection& connection,
+                                              const ::sqlpp::table_t<TableSpec>& table,
+                                              const Range& range) -> container_table_t
+  {
+    using _row_t = std::remove_cv_t<std::remove_pointer_t<decltype(std::data(range))>>;
+    using _module_t = detail::container_module_t<TableSpec, _row_t>;
+    using _data_t = typename _module_t::_data_t;
+
+    auto context = ::sqlpp::sqlite3::context_t{};
+    auto name = to_sql_name(context, table);
+
+    auto* data = new _data_t{std::data(range), std::size(range)};
+    // sqlite3 takes ownership of data, even if the call fails
+    if (const auto rc = sqlite3_create_module_v2(connection.get(), name.c_str(), &_module_t::module, data,
+                                                 &_module_t::destroy_data);
+        rc != SQLITE_OK)
+    {
+      throw sqlpp::exception("Sqlite3: Could not register container table " + name + ": " +
+                             std::string(sqlite3_errstr(rc)));
+    }
+
+    return container_table_t{connection.get(), std::move(name)};
+  }
+}  // namespace sqlpp::sqlite3
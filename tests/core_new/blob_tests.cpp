@@ -0,0 +1,47 @@
+#include <array>
+#include <string>
+#include <vector>
+
+#include <sqlpp17/core/blob_view.h>
+#include <sqlpp17/core/context_base.h>
+#include <sqlpp17/core/data_types.h>
+#include <sqlpp17/core/to_sql_string.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("Serialize blob")
+{
+  auto serialize = [](const auto& expr) { return sqlpp::to_sql_string_c(sqlpp::context_base{}, expr); };
+
+  SECTION("empty")
+  {
+    REQUIRE(serialize(sqlpp::blob_view{}) == "X''");
+  }
+
+  SECTION("bytes")
+  {
+    const auto data = std::array<unsigned char, 4>{0x00, 0x1f, 0xa0, 0xff};
+    REQUIRE(serialize(sqlpp::blob_view{data}) == "X'001FA0FF'");
+  }
+}
+
+TEST_CASE("Construct blob view")
+{
+  const auto data = std::vector<std::byte>{std::byte{1}, std::byte{2}, std::byte{3}};
+  const auto view = sqlpp::blob_view{data};
+
+  REQUIRE(view.data() == data.data());
+  REQUIRE(view.size() == 3);
+  REQUIRE(view == sqlpp::blob_view{std::string{"\x01\x02\x03"}});
+  REQUIRE(view != sqlpp::blob_view{data.data(), 2});
+}
+
+TEST_CASE("Blob value compatibility")
+{
+  static_assert(sqlpp::values_are_compatible_v<sqlpp::blob, sqlpp::blob_view>);
+  static_assert(sqlpp::values_are_compatible_v<sqlpp::blob, std::optional<sqlpp::blob_view>>);
+  static_assert(sqlpp::values_are_compatible_v<sqlpp::blob, std::nullopt_t>);
+  static_assert(not sqlpp::values_are_compatible_v<sqlpp::blob, std::string_view>);
+  static_assert(not sqlpp::values_are_compatible_v<sqlpp::varchar<255>, sqlpp::blob_view>);
+  static_assert(not sqlpp::values_are_compatible_v<std::int64_t, sqlpp::blob_view>);
+}
@@ -0,0 +1,110 @@
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <sqlpp17/core/detail/bounded_queue.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("bounded_queue")
+{
+  SECTION("values are popped in order until the queue is empty")
+  {
+    auto queue = ::sqlpp::detail::bounded_queue_t<int>{4};
+    for (auto i = 0; i < 4; ++i)
+    {
+      REQUIRE(queue.try_push(i));
+    }
+    auto value = 4;
+    REQUIRE_FALSE(queue.try_push(value));
+
+    for (auto i = 0; i < 4; ++i)
+    {
+      REQUIRE(queue.try_pop() == i);
+    }
+    REQUIRE_FALSE(queue.try_pop().has_value());
+    REQUIRE(queue.enqueue_position() == 4);
+    REQUIRE(queue.dequeue_position() == 4);
+
+    // Cells are reused after popping
+    value = 5;
+    REQUIRE(queue.try_push(value));
+    REQUIRE(queue.try_pop() == 5);
+  }
+
+  SECTION("the capacity is exact and values are not moved from if the queue is full")
+  {
+    auto queue = ::sqlpp::detail::bounded_queue_t<std::unique_ptr<int>>{3};
+    REQUIRE(queue.capacity() == 3);
+    REQUIRE_FALSE(queue.try_pop().has_value());
+
+    auto handles = std::vector<std::unique_ptr<int>>{};
+    for (auto i = 0; i < 4; ++i)
+    {
+      handles.push_back(std::make_unique<int>(i));
+    }
+    for (auto i = 0; i < 3; ++i)
+    {
+      REQUIRE(queue.try_push(handles[i]));
+    }
+    REQUIRE_FALSE(queue.try_push(handles[3]));
+    REQUIRE(handles[3]);
+    REQUIRE(queue.size() == 3);
+
+    REQUIRE(**queue.try_pop() == 0);
+    REQUIRE(queue.try_push(handles[3]));
+    for (auto i = 1; i < 4; ++i)
+    {
+      REQUIRE(**queue.try_pop() == i);
+    }
+    REQUIRE_FALSE(queue.try_pop().has_value());
+  }
+
+  SECTION("a queue without capacity keeps nothing")
+  {
+    auto queue = ::sqlpp::detail::bounded_queue_t<int>{0};
+    auto value = 1;
+    REQUIRE_FALSE(queue.try_push(value));
+    REQUIRE_FALSE(queue.try_pop().has_value());
+  }
+
+  SECTION("concurrent producers lose no values")
+  {
+    constexpr auto producer_count = 4;
+    constexpr auto values_per_producer = 10000;
+    auto queue = ::sqlpp::detail::bounded_queue_t<int>{64};
+
+    auto producers = std::vector<std::thread>{};
+    for (auto p = 0; p < producer_count; ++p)
+    {
+      producers.emplace_back([&queue, p]() {
+        for (auto i = 0; i < values_per_producer; ++i)
+        {
+          auto value = p * values_per_producer + i;
+          while (not queue.try_push(value))
+            std::this_thread::yield();
+        }
+      });
+    }
+
+    auto seen = std::vector<bool>(producer_count * values_per_producer, false);
+    auto last = std::vector<int>(producer_count, -1);
+    for (auto received = 0; received < producer_count * values_per_producer;)
+    {
+      if (const auto value = queue.try_pop())
+      {
+        const auto producer = *value / values_per_producer;
+        REQUIRE_FALSE(seen[*value]);
+        REQUIRE(*value > last[producer]);  // FIFO per producer
+        seen[*value] = true;
+        last[producer] = *value;
+        ++received;
+      }
+    }
+    for (auto& producer : producers)
+    {
+      producer.join();
+    }
+    REQUIRE_FALSE(queue.try_pop().has_value());
+  }
+}
@@ -0,0 +1,51 @@
+#include <string_view>
+
+#include <sqlpp17/core/column_batch.h>
+#include <sqlpp17/core/column_spec.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <tables/tab_person.h>
+
+namespace
+{
+  using id_spec = ::sqlpp::column_spec<::sqlpp::name_tag_of_t<test::TabPerson::Id>, std::int64_t, false>;
+  using address_spec = ::sqlpp::column_spec<::sqlpp::name_tag_of_t<test::TabPerson::Address>, std::string_view, true>;
+  using row_t = ::sqlpp::result_row_t<id_spec, address_spec>;
+}  // namespace
+
+TEST_CASE("column_batch")
+{
+  auto batch = ::sqlpp::column_batch_t<row_t>{};
+  REQUIRE(batch.empty());
+
+  SECTION("rows are appended column by column")
+  {
+    for (auto i = 0; i < 100; ++i)
+    {
+      auto row = row_t{};
+      row.id = i;
+      if (i % 3)
+        row.address = (i % 2) ? std::string_view{"odd"} : std::string_view{"even"};
+      ::sqlpp::append_row(batch, row);
+    }
+
+    REQUIRE(batch.size() == 100);
+    REQUIRE(batch.id.values().size() == 100);
+    REQUIRE(batch.address.null_bitmap().size() == 2);
+    for (auto i = 0; i < 100; ++i)
+    {
+      REQUIRE(batch.id[i] == i);
+      REQUIRE(batch.address.is_null(i) == (i % 3 == 0));
+      if (i % 3)
+        REQUIRE(batch.address[i] == ((i % 2) ? "odd" : "even"));
+      else
+        REQUIRE(batch.address[i].empty());
+    }
+    REQUIRE(batch.address.offsets().back() == batch.address.bytes().size());
+
+    batch.clear();
+    REQUIRE(batch.empty());
+    REQUIRE(batch.address.null_bitmap().empty());
+  }
+}
@@ -0,0 +1,92 @@
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <sqlpp17/core/column_spec.h>
+#include <sqlpp17/core/compact_row.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <tables/tab_person.h>
+
+namespace
+{
+  using id_spec = ::sqlpp::column_spec<::sqlpp::name_tag_of_t<test::TabPerson::Id>, std::int64_t, false>;
+  using is_manager_spec = ::sqlpp::column_spec<::sqlpp::name_tag_of_t<test::TabPerson::IsManager>, bool, true>;
+  using address_spec = ::sqlpp::column_spec<::sqlpp::name_tag_of_t<test::TabPerson::Address>, std::string_view, true>;
+  using row_t = ::sqlpp::result_row_t<is_manager_spec, id_spec, address_spec>;
+
+  // Layout checks only, these name tags cannot be used in result_row_t
+  template <std::size_t Index>
+  using wide_spec = ::sqlpp::column_spec<std::integral_constant<std::size_t, Index>, std::int64_t, true>;
+
+  template <std::size_t... Is>
+  auto make_wide_row(std::index_sequence<Is...>) -> ::sqlpp::compact_row_t<::sqlpp::result_row_t<wide_spec<Is>...>>;
+
+  using wide_compact_row_t = decltype(make_wide_row(std::make_index_sequence<50>{}));
+}  // namespace
+
+TEST_CASE("compact_row")
+{
+  SECTION("values are sorted by alignment and the null flags are packed")
+  {
+    // string_view, int64, bool, one byte of null flags
+    STATIC_REQUIRE(sizeof(::sqlpp::compact_row_t<row_t>) == 32);
+    STATIC_REQUIRE(sizeof(::sqlpp::compact_row_t<row_t>) < sizeof(row_t));
+
+    // 50 * 8 bytes of values, 7 bytes of null flags
+    STATIC_REQUIRE(sizeof(wide_compact_row_t) == 408);
+    STATIC_REQUIRE(sizeof(wide_compact_row_t) < 50 * sizeof(std::optional<std::int64_t>));
+  }
+
+  SECTION("fields round trip")
+  {
+    auto rows = std::vector<::sqlpp::compact_row_t<row_t>>{};
+    for (auto i = 0; i < 1000; ++i)
+    {
+      auto row = row_t{};
+      row.id = i;
+      if (i % 3)
+        row.isManager = (i % 2 == 0);
+      if (i % 5)
+        row.address = (i % 2) ? std::string_view{"odd"} : std::string_view{"even"};
+      rows.emplace_back(row);
+    }
+
+    auto sum = std::int64_t{0};
+    for (auto i = 0; i < 1000; ++i)
+    {
+      const auto& row = rows[i];
+      sum += row(test::tabPerson.id);
+      REQUIRE(row.get<1>() == i);
+
+      const auto is_manager = row(test::tabPerson.isManager);
+      REQUIRE(is_manager.has_value() == (i % 3 != 0));
+      REQUIRE(row.is_null<0>() == (i % 3 == 0));
+      if (is_manager)
+        REQUIRE(*is_manager == (i % 2 == 0));
+
+      const auto address = row(test::tabPerson.address);
+      REQUIRE(address.has_value() == (i % 5 != 0));
+      if (address)
+        REQUIRE(*address == ((i % 2) ? "odd" : "even"));
+    }
+    REQUIRE(sum == 999 * 1000 / 2);
+  }
+
+  SECTION("assign overwrites null flags")
+  {
+    auto row = row_t{};
+    row.id = 1;
+    row.address = std::string_view{"somewhere"};
+    auto compact = ::sqlpp::compact_row_t{row};
+    REQUIRE(compact(test::tabPerson.address).has_value());
+
+    row.address.reset();
+    compact.assign(row);
+    REQUIRE(not compact(test::tabPerson.address).has_value());
+    REQUIRE(not compact(test::tabPerson.isManager).has_value());
+  }
+}
@@ -0,0 +1,445 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include <sqlpp17/core/connection_pool.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace
+{
+  std::atomic<int> closed_handles = 0;
+  std::atomic<int> open_handles = 0;
+  std::atomic<int> max_open_handles = 0;
+  std::atomic<int> double_use = 0;  // Catch2 assertions are not thread-safe
+
+  // A handle that counts how often it has been opened and closed and flags concurrent use
+  struct mock_native_t
+  {
+    std::atomic<bool> in_use = false;
+    bool alive = true;
+
+    mock_native_t()
+    {
+      const auto open = ++open_handles;
+      auto max_open = max_open_handles.load();
+      while (open > max_open and not max_open_handles.compare_exchange_weak(max_open, open))
+      {
+      }
+    }
+  };
+
+  struct mock_cleanup_t
+  {
+    auto operator()(mock_native_t* native) const noexcept -> void
+    {
+      ++closed_handles;
+      --open_handles;
+      delete native;
+    }
+  };
+  using mock_handle_t = std::unique_ptr<mock_native_t, mock_cleanup_t>;
+
+  struct mock_config_t
+  {
+  };
+
+  template <typename Pool, ::sqlpp::debug Debug>
+  class mock_connection_t
+  {
+    mock_handle_t _handle;
+    Pool* _pool = nullptr;
+
+    friend Pool;
+
+    mock_connection_t(const mock_config_t&, mock_handle_t&& handle, Pool* pool)
+        : _handle(std::move(handle)), _pool(pool)
+    {
+      if (_handle->in_use.exchange(true))
+        ++double_use;
+    }
+
+    mock_connection_t(const mock_config_t& config, Pool* pool)
+        : mock_connection_t(config, mock_handle_t{new mock_native_t}, pool)
+    {
+    }
+
+  public:
+    mock_connection_t(mock_connection_t&& rhs)
+        : _handle(std::move(rhs._handle)), _pool(std::exchange(rhs._pool, nullptr))
+    {
+    }
+    mock_connection_t& operator=(mock_connection_t&&) = delete;
+    ~mock_connection_t()
+    {
+      if (_pool)
+      {
+        _handle->in_use = false;
+        _pool->put(std::move(_handle));
+      }
+    }
+
+    auto* get() const
+    {
+      return _handle.get();
+    }
+  };
+
+  struct mock_traits
+  {
+    using config_t = mock_config_t;
+    using handle_t = mock_handle_t;
+
+    template <typename Pool, ::sqlpp::debug Debug>
+    using connection_t = mock_connection_t<Pool, Debug>;
+
+    static auto thread_init() -> void
+    {
+    }
+
+    static auto is_alive(handle_t& handle) -> bool
+    {
+      return handle->alive;
+    }
+  };
+
+  using mock_pool_t = ::sqlpp::connection_pool_t<mock_traits, ::sqlpp::debug::none>;
+
+  std::atomic<int> batch_opens = 0;
+
+  struct batch_mock_traits : mock_traits
+  {
+    static auto open_handles(const config_t&, std::size_t count) -> std::vector<handle_t>
+    {
+      ++batch_opens;
+      auto handles = std::vector<handle_t>{};
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        handles.emplace_back(new mock_native_t);
+      }
+      return handles;
+    }
+  };
+
+  using batch_mock_pool_t = ::sqlpp::connection_pool_t<batch_mock_traits, ::sqlpp::debug::none>;
+
+  auto make_options(std::size_t min_size, std::size_t max_size) -> ::sqlpp::connection_pool_options_t
+  {
+    auto options = ::sqlpp::connection_pool_options_t{};
+    options.min_size = min_size;
+    options.max_size = max_size;
+    return options;
+  }
+
+  auto wait_for_waiters(const mock_pool_t& pool, std::size_t count) -> void
+  {
+    while (pool.metrics().waiting != count)
+    {
+      std::this_thread::yield();
+    }
+  }
+
+  // The mutex guarded free list the backends used before, for comparison
+  class mutex_queue_t
+  {
+    std::vector<mock_handle_t> _handles;
+    std::mutex _mutex;
+
+  public:
+    auto try_pop() -> std::optional<mock_handle_t>
+    {
+      const auto lock = std::scoped_lock{_mutex};
+      if (_handles.empty())
+        return std::nullopt;
+      auto handle = std::move(_handles.back());
+      _handles.pop_back();
+      return handle;
+    }
+
+    auto try_push(mock_handle_t& handle) -> bool
+    {
+      const auto lock = std::scoped_lock{_mutex};
+      _handles.push_back(std::move(handle));
+      return true;
+    }
+  };
+
+  template <typename Function>
+  auto run_threads(int thread_count, Function function) -> void
+  {
+    auto threads = std::vector<std::thread>{};
+    for (auto i = 0; i < thread_count; ++i)
+    {
+      threads.emplace_back(function);
+    }
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+  }
+
+  template <typename Queue>
+  auto measure_get_put(Queue& queue, int thread_count, int iterations) -> double
+  {
+    const auto start = std::chrono::steady_clock::now();
+    run_threads(thread_count, [&queue, iterations]() {
+      for (auto i = 0; i < iterations; ++i)
+      {
+        auto handle = queue.try_pop().value_or(mock_handle_t{});
+        if (not handle)
+          handle.reset(new mock_native_t);
+        static_cast<void>(queue.try_push(handle));
+      }
+    });
+    const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return thread_count * iterations / seconds;
+  }
+}  // namespace
+
+TEST_CASE("Pool reuses handles and closes surplus ones")
+{
+  closed_handles = 0;
+  {
+    auto pool = mock_pool_t{1, {}};
+    const auto* native = pool.get().get();
+    REQUIRE(pool.get().get() == native);
+    REQUIRE(closed_handles == 0);
+
+    {
+      auto first = pool.get();
+      auto second = pool.get();
+      REQUIRE(first.get() != second.get());
+    }
+    REQUIRE(closed_handles == 1);
+    REQUIRE(pool.idle_count() == 1);
+  }
+  REQUIRE(closed_handles == 2);
+}
+
+TEST_CASE("Thread cache returns the handle to the thread that put it")
+{
+  auto pool = mock_pool_t{4, {}, sqlpp::thread_cache::on};
+  const auto* native = pool.get().get();
+  REQUIRE(pool.idle_count() == 0);
+
+  const mock_native_t* other_native = nullptr;
+  std::thread{[&pool, &other_native]() { other_native = pool.get().get(); }}.join();
+  REQUIRE(other_native != native);
+
+  REQUIRE(pool.get().get() == native);
+}
+
+TEST_CASE("Pool never hands out a handle twice")
+{
+  double_use = 0;
+  for (const auto cache : {sqlpp::thread_cache::off, sqlpp::thread_cache::on})
+  {
+    auto pool = mock_pool_t{16, {}, cache};
+    run_threads(64, [&pool]() {
+      for (auto i = 0; i < 1000; ++i)
+      {
+        auto connection = pool.get();  // the mock connection checks that the handle is not in use
+        auto other = pool.get();
+      }
+    });
+  }
+  REQUIRE(double_use == 0);
+}
+
+TEST_CASE("Pool with default options keeps idle connections")
+{
+  closed_handles = 0;
+  auto pool = mock_pool_t{::sqlpp::connection_pool_options_t{}, {}};
+  REQUIRE(pool.capacity() == ::sqlpp::connection_pool_options_t::default_max_idle);
+
+  const auto* native = pool.get().get();
+  REQUIRE(pool.get().get() == native);
+  REQUIRE(closed_handles == 0);
+  REQUIRE(pool.metrics().creates == 1);
+}
+
+TEST_CASE("Pool prewarms min_size connections")
+{
+  auto pool = mock_pool_t{make_options(3, 5), {}};
+  const auto metrics = pool.metrics();
+  REQUIRE(metrics.creates == 3);
+  REQUIRE(metrics.open == 3);
+  REQUIRE(metrics.idle == 3);
+  REQUIRE(metrics.in_use == 0);
+
+  REQUIRE_THROWS_AS((mock_pool_t{make_options(6, 5), {}}), sqlpp::exception);
+}
+
+TEST_CASE("Pool prewarms into the idle queue with thread cache")
+{
+  auto options = make_options(3, 0);
+  options.thread_cache = sqlpp::thread_cache::on;
+  auto pool = mock_pool_t{options, {}};
+  REQUIRE(pool.metrics().idle == 3);
+  REQUIRE(pool.idle_count() == 3);
+}
+
+TEST_CASE("Pool prewarms with one batch of concurrently opened handles")
+{
+  batch_opens = 0;
+  auto pool = batch_mock_pool_t{make_options(4, 8), {}};
+  REQUIRE(batch_opens == 1);
+  auto metrics = pool.metrics();
+  REQUIRE(metrics.creates == 4);
+  REQUIRE(metrics.open == 4);
+  REQUIRE(metrics.idle == 4);
+  REQUIRE(metrics.in_use == 0);
+
+  // dead handles are replaced by the next prewarm
+  {
+    auto first = pool.get();
+    auto second = pool.get();
+    first.get()->alive = false;
+    second.get()->alive = false;
+  }
+  for (auto i = 0; i < 4; ++i)
+  {
+    [[maybe_unused]] auto connection = pool.get();
+  }
+  pool.prewarm();
+  metrics = pool.metrics();
+  REQUIRE(batch_opens == 2);
+  REQUIRE(metrics.open == 4);
+  REQUIRE(metrics.evictions == 2);
+  REQUIRE(metrics.creates == 6);
+}
+
+TEST_CASE("Pool times out when max_size connections are in use")
+{
+  auto options = make_options(0, 1);
+  options.wait_timeout = std::chrono::milliseconds{20};
+  auto pool = mock_pool_t{options, {}};
+
+  auto connection = pool.get();
+  REQUIRE_THROWS_AS(pool.get(), sqlpp::exception);
+  const auto metrics = pool.metrics();
+  REQUIRE(metrics.timeouts == 1);
+  REQUIRE(metrics.open == 1);
+  REQUIRE(metrics.in_use == 1);
+  REQUIRE(metrics.waiting == 0);
+}
+
+TEST_CASE("Pool serves waiting threads in FIFO order")
+{
+  auto pool = mock_pool_t{make_options(0, 1), {}};
+  auto order = std::vector<int>{};
+  auto order_mutex = std::mutex{};
+  const mock_native_t* native = nullptr;
+  const mock_native_t* first_native = nullptr;
+
+  auto threads = std::vector<std::thread>{};
+  {
+    auto connection = pool.get();
+    native = connection.get();
+    for (auto i = 0; i < 3; ++i)
+    {
+      threads.emplace_back([&, i]() {
+        auto waiting_connection = pool.get();
+        const auto lock = std::scoped_lock{order_mutex};
+        order.push_back(i);
+        if (i == 0)
+          first_native = waiting_connection.get();
+      });
+      wait_for_waiters(pool, i + 1);
+    }
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  REQUIRE(order == std::vector<int>{0, 1, 2});
+  REQUIRE(first_native == native);
+  REQUIRE(pool.metrics().creates == 1);
+  REQUIRE(pool.metrics().wait_histogram[0] < 4);
+}
+
+TEST_CASE("Pool evicts idle connections after their TTL")
+{
+  auto options = make_options(1, 4);
+  options.idle_ttl = std::chrono::milliseconds{10};
+  auto pool = mock_pool_t{options, {}};
+  {
+    auto first = pool.get();
+    auto second = pool.get();
+  }
+  REQUIRE(pool.metrics().open == 2);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds{20});
+  pool.evict_idle();
+  auto metrics = pool.metrics();
+  REQUIRE(metrics.evictions == 1);
+  REQUIRE(metrics.open == 1);  // min_size
+
+  // expired handles are not reused
+  std::this_thread::sleep_for(std::chrono::milliseconds{20});
+  [[maybe_unused]] auto connection = pool.get();
+  metrics = pool.metrics();
+  REQUIRE(metrics.evictions == 2);
+  REQUIRE(metrics.creates == 3);
+}
+
+TEST_CASE("Pool discards dead connections")
+{
+  auto pool = mock_pool_t{make_options(0, 1), {}};
+  {
+    auto connection = pool.get();
+    connection.get()->alive = false;
+  }
+  auto connection = pool.get();
+  REQUIRE(connection.get()->alive);
+  REQUIRE(pool.metrics().evictions == 1);
+  REQUIRE(pool.metrics().creates == 2);
+  REQUIRE(pool.metrics().open == 1);
+}
+
+TEST_CASE("Bounded pool never exceeds max_size")
+{
+  double_use = 0;
+  auto options = make_options(2, 8);
+  options.wait_timeout = std::chrono::seconds{30};
+  auto pool = mock_pool_t{options, {}};
+  open_handles = 0;
+  max_open_handles = 0;
+  run_threads(64, [&pool]() {
+    for (auto i = 0; i < 1000; ++i)
+    {
+      auto connection = pool.get();
+    }
+  });
+  REQUIRE(max_open_handles <= 8);
+  REQUIRE(pool.metrics().open <= 8);
+  REQUIRE(pool.metrics().in_use == 0);
+  REQUIRE(double_use == 0);
+}
+
+TEST_CASE("Bounded pool rejects the thread cache")
+{
+  // Cached handles would keep their slots while other threads wait for one
+  auto options = make_options(0, 2);
+  options.thread_cache = sqlpp::thread_cache::on;
+  REQUIRE_THROWS_AS((mock_pool_t{options, {}}), sqlpp::exception);
+}
+
+TEST_CASE("Pool scaling benchmark", "[.][benchmark]")
+{
+  const auto iterations = 100'000;
+  for (const auto thread_count : {1, 4, 16, 64})
+  {
+    auto mutex_queue = mutex_queue_t{};
+    auto lock_free_queue = sqlpp::detail::bounded_queue_t<mock_handle_t>{static_cast<std::size_t>(thread_count)};
+
+    std::cout << thread_count << " threads: mutex " << measure_get_put(mutex_queue, thread_count, iterations)
+              << " ops/s, lock-free " << measure_get_put(lock_free_queue, thread_count, iterations) << " ops/s\n";
+  }
+}
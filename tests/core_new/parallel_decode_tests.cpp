@@ -0,0 +1,84 @@
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include <sqlpp17/core/column_spec.h>
+#include <sqlpp17/core/parallel_decode.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <tables/tab_person.h>
+
+namespace
+{
+  using id_spec = ::sqlpp::column_spec<::sqlpp::name_tag_of_t<test::TabPerson::Id>, std::int64_t, false>;
+  using row_t = ::sqlpp::result_row_t<id_spec>;
+
+  struct thread_log_t
+  {
+    std::mutex mutex;
+    std::set<std::thread::id> ids;
+  };
+
+  // A fully buffered result with ids 0..size-1
+  struct mock_handle_t
+  {
+    using row_type = row_t;
+
+    std::size_t _size = 0;
+    thread_log_t* _threads = nullptr;
+
+    [[nodiscard]] auto size() const -> std::size_t
+    {
+      return _size;
+    }
+
+    auto decode_columns(std::size_t begin, std::size_t end, ::sqlpp::column_batch_t<row_t>& batch) const -> void
+    {
+      if (_threads)
+      {
+        const auto lock = std::scoped_lock{_threads->mutex};
+        _threads->ids.insert(std::this_thread::get_id());
+      }
+      for (auto i = begin; i < end; ++i)
+      {
+        batch.id.push_back(static_cast<std::int64_t>(i));
+      }
+    }
+  };
+}  // namespace
+
+TEST_CASE("parallel_decode_columns")
+{
+  SECTION("ranges are decoded concurrently and returned in row order")
+  {
+    auto threads = thread_log_t{};
+    const auto result = ::sqlpp::result_t<mock_handle_t>{mock_handle_t{1001, &threads}};
+    const auto batches = ::sqlpp::parallel_decode_columns(result, 4);
+
+    REQUIRE(batches.size() == 4);
+    auto expected = std::int64_t{0};
+    for (const auto& batch : batches)
+    {
+      REQUIRE(batch.size() >= 250);
+      for (std::size_t i = 0; i < batch.size(); ++i)
+      {
+        REQUIRE(batch.id[i] == expected++);
+      }
+    }
+    REQUIRE(expected == 1001);
+    REQUIRE(threads.ids.size() >= 2);  // ids of finished threads may be reused
+  }
+
+  SECTION("there are no more threads than rows")
+  {
+    const auto result = ::sqlpp::result_t<mock_handle_t>{mock_handle_t{2}};
+    REQUIRE(::sqlpp::parallel_decode_columns(result, 8).size() == 2);
+
+    const auto empty = ::sqlpp::result_t<mock_handle_t>{mock_handle_t{0}};
+    const auto batches = ::sqlpp::parallel_decode_columns(empty, 8);
+    REQUIRE(batches.size() == 1);
+    REQUIRE(batches.front().empty());
+  }
+}
@@ -0,0 +1,123 @@
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <sqlpp17/core/detail/parse_number.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace
+{
+  template <typename T>
+  auto parse(const std::string& text) -> T
+  {
+    auto value = T{};
+    ::sqlpp::detail::parse_number(text.c_str(), text.size(), value);
+    return value;
+  }
+
+  template <typename T>
+  auto parses_fast(const std::string& text) -> bool
+  {
+    auto value = T{};
+    if constexpr (std::is_integral_v<T>)
+      return ::sqlpp::detail::parse_integer_fast(text.c_str(), text.size(), value);
+    else
+      return ::sqlpp::detail::parse_floating_point_fast(text.c_str(), text.size(), value);
+  }
+}  // namespace
+
+TEST_CASE("parse_number")
+{
+  SECTION("integers")
+  {
+    REQUIRE(parse<std::int64_t>("0") == 0);
+    REQUIRE(parse<std::int64_t>("-17") == -17);
+    REQUIRE(parse<std::int64_t>("+12345678") == 12345678);
+    REQUIRE(parse<std::int64_t>("1234567890123456") == 1234567890123456);
+    REQUIRE(parse<std::int64_t>("9223372036854775807") == std::numeric_limits<std::int64_t>::max());
+    REQUIRE(parse<std::int64_t>("-9223372036854775808") == std::numeric_limits<std::int64_t>::min());
+    REQUIRE(parse<std::int32_t>("-2147483648") == std::numeric_limits<std::int32_t>::min());
+  }
+
+  SECTION("odd integers are handed to the C library")
+  {
+    REQUIRE_FALSE(parses_fast<std::int64_t>(""));
+    REQUIRE_FALSE(parses_fast<std::int64_t>("-"));
+    REQUIRE_FALSE(parses_fast<std::int64_t>(" 42"));
+    REQUIRE_FALSE(parses_fast<std::int64_t>("12345678x"));
+    REQUIRE_FALSE(parses_fast<std::int64_t>("9223372036854775808"));
+    REQUIRE_FALSE(parses_fast<std::int64_t>("00000000000000000001"));
+    REQUIRE_FALSE(parses_fast<std::int32_t>("2147483648"));
+
+    REQUIRE(parse<std::int64_t>(" 42") == 42);
+    REQUIRE(parse<std::int64_t>("00000000000000000001") == 1);
+  }
+
+  SECTION("floating point numbers")
+  {
+    REQUIRE(parse<double>("0") == 0.0);
+    REQUIRE(parse<double>("-1.5") == -1.5);
+    REQUIRE(parse<double>(".25") == 0.25);
+    REQUIRE(parse<double>("3.14159265358979") == 3.14159265358979);
+    REQUIRE(parse<double>("1e22") == 1e22);
+    REQUIRE(parse<double>("12.5E-3") == 12.5e-3);
+    REQUIRE(parse<float>("0.1") == 0.1f);
+    REQUIRE(std::signbit(parse<double>("-0.0")));
+  }
+
+  SECTION("odd floating point numbers are handed to the C library")
+  {
+    REQUIRE_FALSE(parses_fast<double>("Infinity"));
+    REQUIRE_FALSE(parses_fast<double>("NaN"));
+    REQUIRE_FALSE(parses_fast<double>("1e23"));
+    REQUIRE_FALSE(parses_fast<double>("0.12345678901234567890"));
+    REQUIRE_FALSE(parses_fast<double>("1e"));
+
+    REQUIRE(std::isinf(parse<double>("Infinity")));
+    REQUIRE(std::isnan(parse<double>("NaN")));
+    REQUIRE(parse<double>("1e23") == 1e23);
+    REQUIRE(parse<double>("0.12345678901234567890") == 0.12345678901234567890);
+  }
+
+  SECTION("columns give the same values as the C library")
+  {
+    constexpr auto row_count = std::size_t{1'000'000};
+    auto engine = std::mt19937_64{42};
+    auto integer_texts = std::vector<std::string>{};
+    auto floating_point_texts = std::vector<std::string>{};
+    for (std::size_t i = 0; i < row_count; ++i)
+    {
+      const auto bits = engine();
+      integer_texts.push_back(std::to_string(static_cast<std::int64_t>(bits >> (bits % 64))));
+      floating_point_texts.push_back(std::to_string(static_cast<double>(static_cast<std::int64_t>(bits)) / 1e12));
+    }
+
+    const auto check_column = [](const std::vector<std::string>& texts, auto expected) {
+      using value_t = decltype(expected(std::string{}));
+      auto pointers = std::vector<const char*>{};
+      auto lengths = std::vector<std::size_t>{};
+      for (const auto& text : texts)
+      {
+        pointers.push_back(text.c_str());
+        lengths.push_back(text.size());
+      }
+      auto values = std::vector<value_t>(texts.size());
+      ::sqlpp::detail::parse_numbers(pointers.data(), lengths.data(), texts.size(), values.data());
+
+      auto mismatches = std::size_t{};
+      for (std::size_t i = 0; i < texts.size(); ++i)
+      {
+        mismatches += (values[i] != expected(texts[i]));
+      }
+      REQUIRE(mismatches == 0);
+    };
+
+    check_column(integer_texts, [](const std::string& text) { return std::strtoll(text.c_str(), nullptr, 10); });
+    check_column(floating_point_texts, [](const std::string& text) { return std::strtod(text.c_str(), nullptr); });
+  }
+}
@@ -0,0 +1,130 @@
+#include <chrono>
+
+#include <sqlpp17/core/run_in_transaction.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace
+{
+  struct mock_connection_t
+  {
+    int begins = 0;
+    int commits = 0;
+    int rollbacks = 0;
+
+    ::sqlpp::transaction_options_t options;
+
+    auto start_transaction(const ::sqlpp::transaction_options_t& transaction_options) -> void
+    {
+      options = transaction_options;
+      ++begins;
+    }
+
+    auto commit() -> void
+    {
+      ++commits;
+    }
+
+    auto rollback() -> void
+    {
+      ++rollbacks;
+    }
+
+    auto destroy_transaction() noexcept -> void
+    {
+      ++rollbacks;
+    }
+  };
+
+  auto no_wait() -> ::sqlpp::retry_policy_t
+  {
+    auto policy = ::sqlpp::retry_policy_t{};
+    policy.initial_backoff = std::chrono::milliseconds{0};
+    return policy;
+  }
+
+  auto failure(::sqlpp::error_code code) -> ::sqlpp::database_exception
+  {
+    return ::sqlpp::database_exception("mock failure", code, 0);
+  }
+}  // namespace
+
+TEST_CASE("Retryable errors run the whole transaction again")
+{
+  auto db = mock_connection_t{};
+  auto options = ::sqlpp::transaction_options_t{};
+  options.isolation = ::sqlpp::isolation_level::serializable;
+  auto calls = 0;
+  const auto result = ::sqlpp::run_in_transaction(
+      db,
+      [&calls](mock_connection_t&) {
+        if (++calls < 3)
+          throw failure(::sqlpp::error_code::serialization_failure);
+        return calls;
+      },
+      no_wait(), options);
+
+  REQUIRE(result == 3);
+  REQUIRE(db.options.isolation == ::sqlpp::isolation_level::serializable);
+  REQUIRE(db.begins == 3);
+  REQUIRE(db.rollbacks == 2);
+  REQUIRE(db.commits == 1);
+}
+
+TEST_CASE("Other errors are not retried")
+{
+  auto db = mock_connection_t{};
+  auto calls = 0;
+  REQUIRE_THROWS_AS(::sqlpp::run_in_transaction(
+                        db,
+                        [&calls](mock_connection_t&) {
+                          ++calls;
+                          throw failure(::sqlpp::error_code::unknown);
+                        },
+                        no_wait()),
+                    ::sqlpp::database_exception);
+
+  REQUIRE(calls == 1);
+  REQUIRE(db.rollbacks == 1);
+  REQUIRE(db.commits == 0);
+}
+
+TEST_CASE("Retries stop after max_attempts")
+{
+  auto db = mock_connection_t{};
+  auto policy = no_wait();
+  policy.max_attempts = 4;
+  auto calls = 0;
+  try
+  {
+    ::sqlpp::run_in_transaction(
+        db,
+        [&calls](mock_connection_t&) {
+          ++calls;
+          throw failure(::sqlpp::error_code::deadlock);
+        },
+        policy);
+    FAIL("expected the last error to be rethrown");
+  }
+  catch (const ::sqlpp::database_exception& e)
+  {
+    REQUIRE(e.code() == ::sqlpp::error_code::deadlock);
+  }
+
+  REQUIRE(calls == 4);
+  REQUIRE(db.rollbacks == 4);
+}
+
+TEST_CASE("Backoff is jittered below an exponentially growing bound")
+{
+  auto policy = ::sqlpp::retry_policy_t{};
+  policy.initial_backoff = std::chrono::milliseconds{10};
+  policy.max_backoff = std::chrono::milliseconds{50};
+
+  for (auto i = 0; i < 100; ++i)
+  {
+    REQUIRE(::sqlpp::detail::backoff(policy, 1) <= std::chrono::milliseconds{10});
+    REQUIRE(::sqlpp::detail::backoff(policy, 2) <= std::chrono::milliseconds{20});
+    REQUIRE(::sqlpp::detail::backoff(policy, 10) <= std::chrono::milliseconds{50});
+  }
+}
@@ -0,0 +1,105 @@
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <sqlpp17/core/sharded_connection.h>
+#include <sqlpp17/core/operator/desc.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <tables/tab_person.h>
+
+namespace
+{
+  struct row_t
+  {
+    std::optional<std::string> address;
+  };
+
+  // The result of one shard, already sorted
+  class mock_result_t
+  {
+    std::vector<row_t> _rows;
+
+  public:
+    class iterator
+    {
+      const mock_result_t* _result;
+      std::size_t _index;
+
+    public:
+      using value_type = row_t;
+
+      iterator(const mock_result_t& result, std::size_t index = 0) : _result(&result), _index(index)
+      {
+      }
+
+      auto operator*() const -> const row_t&
+      {
+        return _result->_rows[_index];
+      }
+
+      auto operator++() -> iterator&
+      {
+        ++_index;
+        return *this;
+      }
+
+      auto operator==(const iterator& rhs) const -> bool
+      {
+        return _index == rhs._index;
+      }
+    };
+
+    mock_result_t(std::vector<std::optional<std::string>> addresses)
+    {
+      for (auto& address : addresses)
+      {
+        _rows.push_back(row_t{std::move(address)});
+      }
+    }
+
+    auto end() const -> iterator
+    {
+      return iterator{*this, _rows.size()};
+    }
+  };
+
+  template <typename SortOrders>
+  auto merge(std::vector<mock_result_t> results, SortOrders sort_orders, ::sqlpp::null_order null_order)
+      -> std::vector<std::optional<std::string>>
+  {
+    auto handle = ::sqlpp::detail::merged_result_handle_t<mock_result_t, SortOrders>{
+        std::move(results), std::move(sort_orders), null_order, std::nullopt};
+    auto addresses = std::vector<std::optional<std::string>>{};
+    for (handle.get_next_row(); handle; handle.get_next_row())
+    {
+      addresses.push_back(handle.row().address);
+    }
+    return addresses;
+  }
+
+  using addresses_t = std::vector<std::optional<std::string>>;
+}  // namespace
+
+TEST_CASE("Merging sharded results sorts NULL like the database")
+{
+  const auto ascending = std::tuple{::sqlpp::asc(test::tabPerson.address)};
+  const auto descending = std::tuple{::sqlpp::desc(test::tabPerson.address)};
+
+  SECTION("SQLite and MySQL sort NULL first in ascending order")
+  {
+    REQUIRE(merge({mock_result_t{{std::nullopt, "b"}}, mock_result_t{{std::nullopt, "a", "c"}}}, ascending,
+                  ::sqlpp::null_order::first) == addresses_t{std::nullopt, std::nullopt, "a", "b", "c"});
+    REQUIRE(merge({mock_result_t{{"b", std::nullopt}}, mock_result_t{{"c", "a", std::nullopt}}}, descending,
+                  ::sqlpp::null_order::first) == addresses_t{"c", "b", "a", std::nullopt, std::nullopt});
+  }
+
+  SECTION("PostgreSQL sorts NULL last in ascending order")
+  {
+    REQUIRE(merge({mock_result_t{{"b", std::nullopt}}, mock_result_t{{"a", "c", std::nullopt}}}, ascending,
+                  ::sqlpp::null_order::last) == addresses_t{"a", "b", "c", std::nullopt, std::nullopt});
+    REQUIRE(merge({mock_result_t{{std::nullopt, "b"}}, mock_result_t{{std::nullopt, "c", "a"}}}, descending,
+                  ::sqlpp::null_order::last) == addresses_t{std::nullopt, std::nullopt, "c", "b", "a"});
+  }
+}
@@ -177,7 +177,7 @@ namespace sqlpp::test
       }
     }
 
-    auto start_transaction() -> void
+    auto start_transaction(const ::sqlpp::transaction_options_t& = {}) -> void
     {
     }
 
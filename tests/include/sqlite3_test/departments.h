@@ -0,0 +1,47 @@
+#pragma once
+
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <string>
+
+namespace sqlpp::sqlite3::test
+{
+  // (Re-)creates tab_department with the ids 0 to 9. Every third name is NULL (name<id> otherwise), the division is
+  // division<id % 2>.
+  template <typename Connection>
+  auto create_departments(Connection& db) -> void
+  {
+    db(std::string("DROP TABLE IF EXISTS tab_department"));
+    db(std::string("CREATE TABLE tab_department (id INTEGER PRIMARY KEY, name TEXT, division TEXT)"));
+    for (auto i = 0; i < 10; ++i)
+    {
+      const auto name = (i % 3 == 0) ? std::string("NULL") : "'name" + std::to_string(i) + "'";
+      db("INSERT INTO tab_department (id, name, division) VALUES (" + std::to_string(i) + ", " + name +
+         ", 'division" + std::to_string(i % 2) + "')");
+    }
+  }
+}  // namespace sqlpp::sqlite3::test
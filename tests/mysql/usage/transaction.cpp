@@ -61,6 +61,16 @@ int main()
       // ...
       // tx' destructor will auto-rollback the transaction
     }
+
+    // read only snapshot
+    {
+      auto options = ::sqlpp::transaction_options_t{};
+      options.isolation = ::sqlpp::isolation_level::repeatable_read;
+      options.read_only = true;
+      auto tx = start_transaction(db, options);
+      // ...
+      tx.commit();
+    }
   }
   catch (const std::exception& e)
   {
@@ -40,6 +40,15 @@ int main()
     ::sqlpp::test::test_single_connection(pool);
     ::sqlpp::test::test_multiple_connections(pool);
     ::sqlpp::test::test_multithreaded(pool);
+
+    // prewarmed connections are established concurrently
+    auto options = ::sqlpp::connection_pool_options_t{};
+    options.min_size = 8;
+    options.max_size = 8;
+    auto prewarmed_pool = postgresql::connection_pool_t<::sqlpp::debug::none>{options, postgresql::test::get_config()};
+    if (prewarmed_pool.metrics().idle != 8)
+      throw std::runtime_error("Expected 8 prewarmed connections");
+    ::sqlpp::test::test_multiple_connections(prewarmed_pool);
   }
   catch (const std::exception& e)
   {
@@ -0,0 +1,90 @@
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <atomic>
+
+#include <iostream>
+
+#include <sqlpp17/core/clause/create_table.h>
+#include <sqlpp17/core/clause/drop_table.h>
+#include <sqlpp17/core/clause/insert_into.h>
+#include <sqlpp17/core/clause/order_by.h>
+#include <sqlpp17/core/clause/select.h>
+#include <sqlpp17/core/parallel_decode.h>
+
+#include <sqlpp17/postgresql/connection.h>
+#include <sqlpp17/postgresql_test/get_config.h>
+
+#include <core_test/require.h>
+#include <core_test/tables/TabDepartment.h>
+
+using test::require;
+
+namespace postgresql = ::sqlpp::postgresql;
+
+int main()
+{
+  try
+  {
+    using test::tabDepartment;
+
+    const auto config = postgresql::test::get_config();
+    auto db = postgresql::connection_t<::sqlpp::debug::allowed>{config};
+    db(drop_table(tabDepartment));
+    db(create_table(tabDepartment));
+
+    constexpr auto row_count = 1000;
+    for (auto i = 0; i < row_count; ++i)
+    {
+      db(insert_into(tabDepartment).set(tabDepartment.name = "department"));
+    }
+
+    auto result =
+        db(::sqlpp::select(tabDepartment.id, tabDepartment.name).from(tabDepartment).order_by(asc(tabDepartment.id)));
+    require(result.size() == row_count, "expected the size of the buffered result");
+
+    // Random access does not depend on the iteration position
+    const auto first_id = result.front().id;
+    require(result[row_count - 1].id == first_id + row_count - 1, "expected the last row");
+    require(result[0].id == first_id, "expected the first row");
+
+    auto expected_id = first_id;
+    for (const auto& batch : ::sqlpp::parallel_decode_columns(result, 4))
+    {
+      for (std::size_t i = 0; i < batch.size(); ++i)
+      {
+        require(batch.id[i] == expected_id++, "expected the batches in row order");
+        require(batch.name[i] == "department", "unexpected name");
+      }
+    }
+    require(expected_id == first_id + row_count, "expected all rows to be decoded");
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
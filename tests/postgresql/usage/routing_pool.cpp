@@ -0,0 +1,110 @@
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
+#include <sqlpp17/core/clause/create_table.h>
+#include <sqlpp17/core/clause/drop_table.h>
+#include <sqlpp17/core/clause/select.h>
+#include <sqlpp17/core/function.h>
+#include <sqlpp17/core/routing_pool.h>
+
+#include <sqlpp17/postgresql/connection_pool.h>
+#include <sqlpp17/postgresql_test/get_config.h>
+
+#include <core_test/require.h>
+#include <core_test/tables/TabDepartment.h>
+
+using test::require;
+
+namespace postgresql = ::sqlpp::postgresql;
+
+namespace
+{
+  SQLPP_CREATE_NAME_TAG(rowCount);
+
+  // SQLPP17_TEST_POSTGRESQL_REPLICAS=host:port,host:port,... selects replica instances, by default the primary's
+  // instance serves as two replicas
+  auto get_replica_configs(const postgresql::connection_config_t& primary)
+      -> std::vector<postgresql::connection_config_t>
+  {
+    auto configs = std::vector<postgresql::connection_config_t>{};
+    const auto* replicas = std::getenv("SQLPP17_TEST_POSTGRESQL_REPLICAS");
+    if (not replicas)
+      return {primary, primary};
+
+    auto stream = std::istringstream{replicas};
+    for (auto replica = std::string{}; std::getline(stream, replica, ',');)
+    {
+      auto config = primary;
+      const auto colon = replica.find(':');
+      config.host = replica.substr(0, colon);
+      if (colon != std::string::npos)
+        config.port = replica.substr(colon + 1);
+      configs.push_back(config);
+    }
+    return configs;
+  }
+}  // namespace
+
+int main()
+{
+  try
+  {
+    const auto primary = postgresql::test::get_config();
+    const auto replicas = get_replica_configs(primary);
+    auto pool = ::sqlpp::routing_pool_t<postgresql::connection_pool_t<::sqlpp::debug::allowed>>{
+        {}, {}, primary, replicas};
+
+    // writes go to the primary, replicas are expected to replicate the table
+    {
+      auto db = pool.get();
+      db(drop_table(::test::tabDepartment));
+      db(create_table(::test::tabDepartment));
+    }
+
+    for (std::size_t i = 0; i < 2 * replicas.size(); ++i)
+    {
+      auto db = pool.get();
+      auto result = db(::sqlpp::select(::sqlpp::count(1).as(rowCount)).from(::test::tabDepartment).unconditionally());
+      require(result.front().rowCount == 0, "expected an empty table");
+    }
+
+    for (const auto& status : pool.replica_status())
+    {
+      require(status.healthy, "expected all replicas to be healthy");
+      require(status.reads == 2, "expected reads to be distributed round robin");
+    }
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
@@ -62,6 +62,26 @@ int main()
       // ...
       // tx' destructor will auto-rollback the transaction
     }
+
+    // report without serialization failures
+    {
+      auto options = ::sqlpp::transaction_options_t{};
+      options.isolation = ::sqlpp::isolation_level::serializable;
+      options.read_only = true;
+      options.deferrable = true;
+      auto tx = start_transaction(db, options);
+      // ...
+      tx.commit();
+    }
+
+    // BEGIN is sent with the first statement, in one round trip
+    {
+      auto options = ::sqlpp::transaction_options_t{};
+      options.lazy = true;
+      auto tx = start_transaction(db, options);
+      db(::sqlpp::command("SELECT 1"));
+      tx.commit();
+    }
   }
   catch (const std::exception& e)
   {
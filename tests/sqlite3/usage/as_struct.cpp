@@ -0,0 +1,95 @@
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <atomic>
+
+#include <iostream>
+#include <optional>
+#include <string>
+
+#include <sqlpp17/core/clause/select.h>
+
+#include <sqlpp17/sqlite3/connection.h>
+#include <sqlpp17/sqlite3_test/departments.h>
+#include <sqlpp17/sqlite3_test/get_config.h>
+
+#include <core_test/require.h>
+#include <core_test/tables/TabDepartment.h>
+
+using test::require;
+
+namespace
+{
+  // Members are matched by name, their order does not matter
+  struct department_t
+  {
+    std::string division;
+    std::optional<std::string> name;
+    std::int64_t id = 0;
+  };
+
+  template <typename Departments>
+  auto check_departments(const Departments& departments) -> void
+  {
+    require(departments.size() == 10, "expected all rows");
+    for (auto id = 0; id < 10; ++id)
+    {
+      const auto& department = departments[id];
+      require(department.id == id, "unexpected id");
+      require(department.name.has_value() == (id % 3 != 0), "unexpected NULL");
+      if (department.name)
+        require(*department.name == "name" + std::to_string(id), "unexpected name");
+      require(department.division == "division" + std::to_string(id % 2), "unexpected division");
+    }
+  }
+}  // namespace
+
+int main()
+{
+  try
+  {
+    using test::tabDepartment;
+
+    auto config = ::sqlpp::sqlite3::test::get_config();
+    config.debug = nullptr;
+    auto db = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::none>{config};
+    ::sqlpp::sqlite3::test::create_departments(db);
+
+    const auto statement = ::sqlpp::select(tabDepartment.id, tabDepartment.name, tabDepartment.division)
+                               .from(tabDepartment)
+                               .unconditionally();
+
+    check_departments(db(statement).as<department_t>());
+
+    auto prepared_statement = db.prepare(statement);
+    check_departments(execute(prepared_statement).as<department_t>());
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
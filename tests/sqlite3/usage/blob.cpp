@@ -0,0 +1,131 @@
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <iostream>
+#include <vector>
+
+#include <sqlpp17/core/clause/insert_into.h>
+#include <sqlpp17/core/clause/select.h>
+#include <sqlpp17/core/parameter.h>
+
+#include <sqlpp17/sqlite3/blob_stream.h>
+#include <sqlpp17/sqlite3/connection.h>
+#include <sqlpp17/sqlite3_test/get_config.h>
+
+#include <core_test/require.h>
+#include <core_test/tables/TabBlob.h>
+
+using test::require;
+
+namespace
+{
+  SQLPP_CREATE_NAME_TAG(pData);
+
+  auto make_data(std::size_t size) -> std::vector<std::byte>
+  {
+    auto data = std::vector<std::byte>(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      data[i] = static_cast<std::byte>(i * 7);
+    }
+    return data;
+  }
+}  // namespace
+
+int main()
+{
+  try
+  {
+    const auto config = ::sqlpp::sqlite3::test::get_config();
+    auto db = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::allowed>{config};
+
+    db(std::string("DROP TABLE IF EXISTS tab_blob"));
+    db(std::string("CREATE TABLE tab_blob (id INTEGER PRIMARY KEY AUTOINCREMENT, data BLOB)"));
+
+    using test::tabBlob;
+    const auto data = make_data(1000);
+
+    // literal and parameter binding
+    const auto literal_id = db(insert_into(tabBlob).set(tabBlob.data = ::sqlpp::blob_view{data}));
+    auto prepared_insert = db.prepare(
+        insert_into(tabBlob).set(tabBlob.data = ::sqlpp::parameter<std::optional<::sqlpp::blob_view>>(pData)));
+    prepared_insert.parameters.pData = ::sqlpp::blob_view{data};
+    const auto parameter_id = execute(prepared_insert);
+    prepared_insert.parameters.pData = ::sqlpp::blob_view{};
+    const auto empty_id = execute(prepared_insert);
+    prepared_insert.parameters.pData = std::nullopt;
+    const auto null_id = execute(prepared_insert);
+
+    for (const auto id : {literal_id, parameter_id})
+    {
+      auto result = db(::sqlpp::select(tabBlob.data).from(tabBlob).where(tabBlob.id == id));
+      const auto& row = result.front();
+      require(row.data and *row.data == ::sqlpp::blob_view{data}, "blob was not read back correctly");
+    }
+    {
+      auto result = db(::sqlpp::select(tabBlob.data).from(tabBlob).where(tabBlob.id == empty_id));
+      const auto& row = result.front();
+      require(row.data and row.data->empty(), "empty blob was not read back correctly");
+    }
+    {
+      auto result = db(::sqlpp::select(tabBlob.data).from(tabBlob).where(tabBlob.id == null_id));
+      require(not result.front().data, "NULL blob was not read back correctly");
+    }
+
+    // incremental I/O
+    const auto chunk_size = std::size_t{64};
+    const auto large = make_data(100 * chunk_size + 17);
+    const auto stream_id = db(insert_into(tabBlob).set(tabBlob.data = ::sqlpp::sqlite3::zeroblob(large.size())));
+    {
+      auto stream = ::sqlpp::sqlite3::blob_stream_t{db, tabBlob.data, stream_id, ::sqlpp::sqlite3::blob_mode::read_write};
+      require(stream.size() == large.size(), "unexpected blob size");
+      for (std::size_t offset = 0; offset < large.size(); offset += chunk_size)
+      {
+        const auto size = std::min(chunk_size, large.size() - offset);
+        stream.write(::sqlpp::blob_view{large.data() + offset, size}, offset);
+      }
+    }
+    {
+      auto stream = ::sqlpp::sqlite3::blob_stream_t{db, tabBlob.data, stream_id};
+      auto chunk = std::vector<std::byte>(chunk_size);
+      for (std::size_t offset = 0; offset < large.size(); offset += chunk_size)
+      {
+        const auto size = std::min(chunk_size, large.size() - offset);
+        stream.read(chunk.data(), size, offset);
+        require(::sqlpp::blob_view{chunk.data(), size} == ::sqlpp::blob_view{large.data() + offset, size},
+                "streamed blob was not read back correctly");
+      }
+
+      stream.reopen(literal_id);
+      require(stream.size() == data.size(), "unexpected blob size after reopen");
+    }
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
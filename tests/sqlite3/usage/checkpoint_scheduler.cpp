@@ -0,0 +1,85 @@
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+#include <sqlpp17/sqlite3/checkpoint_scheduler.h>
+#include <sqlpp17/sqlite3/connection.h>
+#include <sqlpp17/sqlite3_test/get_config.h>
+
+int main()
+{
+  try
+  {
+    using namespace std::chrono_literals;
+
+    auto config = ::sqlpp::sqlite3::test::get_config();
+    config.path_to_database = "checkpoint_test";
+    config.debug = nullptr;
+
+    auto db = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::allowed>{config};
+    db(std::string("PRAGMA journal_mode = WAL"));
+    db(std::string("PRAGMA busy_timeout = 5000"));
+    db(std::string("DROP TABLE IF EXISTS tab_checkpoint"));
+    db(std::string("CREATE TABLE tab_checkpoint (id INTEGER PRIMARY KEY, payload TEXT)"));
+
+    auto checkpoint_config = ::sqlpp::sqlite3::checkpoint_config_t{};
+    checkpoint_config.passive_threshold_frames = 10;
+    checkpoint_config.truncate_threshold_frames = 50;
+    checkpoint_config.interval = 10ms;
+
+    auto scheduler = ::sqlpp::sqlite3::checkpoint_scheduler_t{config, checkpoint_config};
+    scheduler.attach(db);
+
+    for (auto i = 0; i < 200; ++i)
+    {
+      db(std::string("INSERT INTO tab_checkpoint (payload) VALUES (hex(randomblob(2000)))"));
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + 10s;
+    auto metrics = scheduler.metrics();
+    while (metrics.passive_checkpoints + metrics.truncate_checkpoints == 0 and
+           std::chrono::steady_clock::now() < deadline)
+    {
+      std::this_thread::sleep_for(10ms);
+      metrics = scheduler.metrics();
+    }
+
+    if (metrics.passive_checkpoints + metrics.truncate_checkpoints == 0)
+      throw std::runtime_error("Expected the scheduler to run checkpoints");
+    if (metrics.failed_checkpoints != 0)
+      throw std::runtime_error("Unexpected failed checkpoints");
+
+    scheduler.detach(db);
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
@@ -0,0 +1,96 @@
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <atomic>
+
+#include <iostream>
+
+#include <sqlpp17/core/clause/select.h>
+
+#include <sqlpp17/sqlite3/connection.h>
+#include <sqlpp17/sqlite3_test/departments.h>
+#include <sqlpp17/sqlite3_test/get_config.h>
+
+#include <core_test/require.h>
+#include <core_test/tables/TabDepartment.h>
+
+using test::require;
+
+int main()
+{
+  try
+  {
+    using test::tabDepartment;
+
+    auto config = ::sqlpp::sqlite3::test::get_config();
+    config.debug = nullptr;
+    auto db = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::none>{config};
+    ::sqlpp::sqlite3::test::create_departments(db);
+
+    const auto statement = ::sqlpp::select(tabDepartment.id, tabDepartment.name, tabDepartment.division)
+                               .from(tabDepartment)
+                               .unconditionally();
+
+    // Batches of up to four rows
+    {
+      auto result = db(statement);
+      auto batch = decltype(result.fetch_columns(0)){};
+      auto first_id = int64_t{0};
+      for (const auto expected_size : {std::size_t{4}, std::size_t{4}, std::size_t{2}, std::size_t{0}})
+      {
+        require(result.fetch_columns(batch, 4) == expected_size, "unexpected batch size");
+        require(batch.id.size() == expected_size and batch.name.size() == expected_size and
+                    batch.division.size() == expected_size,
+                "expected equally long columns");
+        for (auto i = std::size_t{0}; i < expected_size; ++i)
+        {
+          const auto id = first_id + static_cast<int64_t>(i);
+          require(batch.id[i] == id, "unexpected id");
+          require(batch.name.is_null(i) == (id % 3 == 0), "unexpected null bitmap");
+          if (not batch.name.is_null(i))
+            require(std::string(batch.name[i]) == "name" + std::to_string(id), "unexpected name");
+          require(std::string(batch.division[i]) == "division" + std::to_string(id % 2), "unexpected division");
+        }
+        first_id += static_cast<int64_t>(expected_size);
+      }
+    }
+
+    // Rows that have been visited by an iterator are not included
+    {
+      auto result = db(statement);
+      require(result.front().id == 0, "unexpected first row");
+      const auto batch = result.fetch_columns(100);
+      require(batch.size() == 9, "expected the remaining rows");
+      require(batch.id[0] == 1, "expected the batch to start after the current row");
+      require(batch.id.values().back() == 9, "expected contiguous values");
+    }
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
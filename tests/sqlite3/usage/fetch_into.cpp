@@ -0,0 +1,90 @@
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <atomic>
+
+#include <iostream>
+#include <memory_resource>
+#include <vector>
+
+#include <sqlpp17/core/clause/select.h>
+
+#include <sqlpp17/sqlite3/connection.h>
+#include <sqlpp17/sqlite3_test/departments.h>
+#include <sqlpp17/sqlite3_test/get_config.h>
+
+#include <core_test/require.h>
+#include <core_test/tables/TabDepartment.h>
+
+using test::require;
+
+int main()
+{
+  try
+  {
+    using test::tabDepartment;
+
+    auto config = ::sqlpp::sqlite3::test::get_config();
+    config.debug = nullptr;
+    auto db = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::none>{config};
+    ::sqlpp::sqlite3::test::create_departments(db);
+
+    const auto statement = ::sqlpp::select(tabDepartment.id, tabDepartment.name, tabDepartment.division)
+                               .from(tabDepartment)
+                               .unconditionally();
+    using row_t = decltype(db(statement))::row_type;
+
+    auto arena = std::pmr::monotonic_buffer_resource{};
+    auto rows = std::vector<row_t>{};
+    {
+      auto result = db(statement);
+      auto chunk = std::vector<row_t>(4);
+      for (const auto expected_size : {std::size_t{4}, std::size_t{4}, std::size_t{2}, std::size_t{0}})
+      {
+        const auto fetched = result.fetch_into(chunk, arena);
+        require(fetched == expected_size, "unexpected number of rows");
+        rows.insert(rows.end(), chunk.begin(), chunk.begin() + fetched);
+      }
+    }
+
+    // The text fields outlive the result
+    require(rows.size() == 10, "expected all rows");
+    for (auto id = 0; id < 10; ++id)
+    {
+      const auto& row = rows[id];
+      require(row.id == id, "unexpected id");
+      require(row.name.has_value() == (id % 3 != 0), "unexpected NULL");
+      if (row.name)
+        require(std::string(*row.name) == "name" + std::to_string(id), "unexpected name");
+      require(std::string(row.division) == "division" + std::to_string(id % 2), "unexpected division");
+    }
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
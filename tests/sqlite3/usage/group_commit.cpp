@@ -0,0 +1,131 @@
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <atomic>
+
+#include <algorithm>
+#include <future>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <sqlpp17/core/clause/insert_into.h>
+#include <sqlpp17/core/clause/select.h>
+
+#include <sqlpp17/sqlite3/connection.h>
+#include <sqlpp17/sqlite3/group_commit.h>
+#include <sqlpp17/sqlite3_test/get_config.h>
+
+#include <core_test/require.h>
+#include <core_test/tables/TabDepartment.h>
+
+using test::require;
+
+int main()
+{
+  try
+  {
+    using test::tabDepartment;
+    using namespace std::chrono_literals;
+
+    auto config = ::sqlpp::sqlite3::test::get_config();
+    config.path_to_database = "group_commit";
+    config.debug = nullptr;
+    {
+      auto db = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::none>{config};
+      db(std::string("DROP TABLE IF EXISTS tab_department"));
+      db(std::string("CREATE TABLE tab_department (id INTEGER PRIMARY KEY, name TEXT, division TEXT)"));
+    }
+
+    constexpr auto thread_count = 8;
+    constexpr auto inserts_per_thread = 50;
+    auto group_config = ::sqlpp::sqlite3::group_commit_config_t{};
+    group_config.max_delay = 1ms;
+    auto ids = std::vector<int64_t>{};
+    auto metrics = ::sqlpp::sqlite3::group_commit_metrics_t{};
+    {
+      auto group_commit = ::sqlpp::sqlite3::group_commit_t{config, group_config};
+      auto futures = std::vector<std::future<int64_t>>(thread_count * inserts_per_thread);
+      auto threads = std::vector<std::thread>{};
+      for (auto t = 0; t < thread_count; ++t)
+      {
+        threads.emplace_back([&, t]() {
+          for (auto i = 0; i < inserts_per_thread; ++i)
+          {
+            futures[t * inserts_per_thread + i] = group_commit.submit([](auto& db) {
+              return static_cast<int64_t>(db(::sqlpp::insert_into(tabDepartment).set(tabDepartment.name = "ok")));
+            });
+          }
+        });
+      }
+      for (auto& thread : threads)
+      {
+        thread.join();
+      }
+
+      // A failing closure does not affect the others in its batch
+      auto failing = group_commit.submit([](auto& db) {
+        db(::sqlpp::insert_into(tabDepartment).set(tabDepartment.name = "failed"));
+        throw std::runtime_error("closure failed");
+      });
+      auto last = group_commit.submit(
+          [](auto& db) { db(::sqlpp::insert_into(tabDepartment).set(tabDepartment.name = "last")); });
+
+      for (auto& future : futures)
+      {
+        ids.push_back(future.get());
+      }
+      try
+      {
+        failing.get();
+        require(false, "expected the exception of the closure");
+      }
+      catch (const std::runtime_error& e)
+      {
+        require(std::string(e.what()) == "closure failed", "expected the exception of the closure");
+      }
+      last.get();
+      metrics = group_commit.metrics();
+    }
+
+    std::sort(ids.begin(), ids.end());
+    require(std::unique(ids.begin(), ids.end()) == ids.end(), "expected one row per closure");
+    require(metrics.closures == thread_count * inserts_per_thread + 1, "expected all other closures to be committed");
+    require(metrics.failed_closures == 1, "expected one failed closure");
+    require(metrics.batches < metrics.closures, "expected closures to share transactions");
+
+    auto db = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::none>{config};
+    require(db(::sqlpp::select(tabDepartment.id).from(tabDepartment).where(tabDepartment.name == "failed")).empty(),
+            "expected the changes of the failed closure to be rolled back");
+    require(not db(::sqlpp::select(tabDepartment.id).from(tabDepartment).where(tabDepartment.name == "last")).empty(),
+            "expected the last closure to be committed");
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
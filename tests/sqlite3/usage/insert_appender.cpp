@@ -0,0 +1,156 @@
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <atomic>
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <sqlpp17/core/clause/select.h>
+#include <sqlpp17/core/insert_appender.h>
+
+#include <sqlpp17/sqlite3/connection.h>
+#include <sqlpp17/sqlite3_test/get_config.h>
+
+#include <core_test/require.h>
+#include <core_test/tables/TabDepartment.h>
+
+using test::require;
+
+namespace
+{
+  template <typename Connection>
+  auto count_rows(Connection& db) -> std::size_t
+  {
+    auto count = std::size_t{0};
+    auto result = db(::sqlpp::select(test::tabDepartment.id).from(test::tabDepartment).unconditionally());
+    for (auto it = result.begin(); not(it == result.end()); ++it)
+    {
+      ++count;
+    }
+    return count;
+  }
+}  // namespace
+
+int main()
+{
+  try
+  {
+    using test::tabDepartment;
+    using namespace std::chrono_literals;
+    using connection_t = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::none>;
+
+    auto config = ::sqlpp::sqlite3::test::get_config();
+    config.path_to_database = "insert_appender";
+    config.debug = nullptr;
+    auto db = connection_t{config};
+    db(std::string("DROP TABLE IF EXISTS tab_department"));
+    db(std::string(
+        "CREATE TABLE tab_department (id INTEGER PRIMARY KEY, name TEXT CHECK (name <> 'bad'), division TEXT)"));
+
+    constexpr auto thread_count = 4;
+    constexpr auto rows_per_thread = 500;
+    auto errors = std::atomic<int>{0};
+    auto options = ::sqlpp::insert_appender_options_t{};
+    options.queue_capacity = 16;  // small enough to make producers wait
+    options.max_batch_size = 50;
+    options.flush_interval = 1h;  // only full batches, flush() and close() write
+    options.on_error = [&errors](std::exception_ptr) { ++errors; };
+
+    using appender_t =
+        ::sqlpp::insert_appender_t<connection_t, decltype(tabDepartment), decltype(tabDepartment.name = std::string{})>;
+    auto appender = appender_t{connection_t{config}, tabDepartment, options};
+
+    auto threads = std::vector<std::thread>{};
+    for (auto t = 0; t < thread_count; ++t)
+    {
+      threads.emplace_back([&]() {
+        for (auto i = 0; i < rows_per_thread; ++i)
+        {
+          appender.push(tabDepartment.name = std::string("ok"));
+        }
+      });
+    }
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+
+    // A failing row does not affect the others in its batch
+    appender.push(tabDepartment.name = std::string("bad"));
+    appender.push(tabDepartment.name = std::string("last"));
+    appender.flush();
+    require(count_rows(db) == thread_count * rows_per_thread + 1, "expected all rows after flush()");
+    require(errors == 1, "expected one failed row");
+
+    // Rows pushed before close() are written, later pushes are rejected
+    appender.push(tabDepartment.name = std::string("closing"));
+    const auto metrics = appender.close();
+    require(count_rows(db) == thread_count * rows_per_thread + 2, "expected all rows after close()");
+    require(metrics.rows_pushed == metrics.rows_written + metrics.rows_failed, "expected no lost rows");
+    require(metrics.rows_failed == 1, "expected one failed row in the metrics");
+    require(metrics.batches < metrics.rows_written, "expected rows to share statements");
+    try
+    {
+      appender.push(tabDepartment.name = std::string("too late"));
+      require(false, "expected push() after close() to throw");
+    }
+    catch (const ::sqlpp::exception&)
+    {
+    }
+
+    // An error handler that throws does not stop the worker
+    {
+      auto throwing_options = ::sqlpp::insert_appender_options_t{};
+      throwing_options.on_error = [](std::exception_ptr) { throw std::runtime_error("error handler failed"); };
+      auto throwing_appender = appender_t{connection_t{config}, tabDepartment, throwing_options};
+      throwing_appender.push(tabDepartment.name = std::string("bad"));
+      throwing_appender.push(tabDepartment.name = std::string("after bad"));
+      const auto throwing_metrics = throwing_appender.close();
+      require(throwing_metrics.rows_failed == 1 and throwing_metrics.rows_written == 1,
+              "expected the worker to continue after the error handler threw");
+    }
+
+    // A queue without room would block every push
+    try
+    {
+      auto empty_options = ::sqlpp::insert_appender_options_t{};
+      empty_options.queue_capacity = 0;
+      auto empty_appender = appender_t{connection_t{config}, tabDepartment, empty_options};
+      require(false, "expected queue_capacity 0 to be rejected");
+    }
+    catch (const ::sqlpp::exception&)
+    {
+    }
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
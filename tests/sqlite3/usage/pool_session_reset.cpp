@@ -0,0 +1,117 @@
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <atomic>
+#include <iostream>
+#include <string_view>
+
+#include <sqlpp17/sqlite3/connection_pool.h>
+#include <sqlpp17/sqlite3_test/get_config.h>
+
+#include <core_test/require.h>
+
+using test::require;
+
+namespace
+{
+  std::atomic<int> rollbacks = 0;
+
+  auto count_rollbacks(unsigned, void*, void* statement, void*) -> int
+  {
+    if (std::string_view{sqlite3_sql(static_cast<sqlite3_stmt*>(statement))} == "ROLLBACK")
+      ++rollbacks;
+    return 0;
+  }
+
+  auto post_connect(::sqlite3* db) -> void
+  {
+    sqlite3_trace_v2(db, SQLITE_TRACE_STMT, count_rollbacks, nullptr);
+  }
+
+  auto count_rows(::sqlite3* db) -> int
+  {
+    auto count = 0;
+    sqlite3_exec(
+        db, "SELECT count(*) FROM tab_reset",
+        [](void* count, int, char** values, char**) {
+          *static_cast<int*>(count) = std::stoi(values[0]);
+          return 0;
+        },
+        &count, nullptr);
+    return count;
+  }
+}  // namespace
+
+int main()
+{
+  try
+  {
+    auto config = ::sqlpp::sqlite3::test::get_config();
+    config.post_connect = post_connect;
+    auto options = ::sqlpp::connection_pool_options_t{};
+    options.max_size = 1;
+    auto pool = ::sqlpp::sqlite3::connection_pool_t<::sqlpp::debug::allowed>{options, config};
+
+    {
+      auto db = pool.get();
+      db(std::string("DROP TABLE IF EXISTS tab_reset"));
+      db(std::string("CREATE TABLE tab_reset (id INTEGER PRIMARY KEY)"));
+    }
+    require(rollbacks == 0, "clean connections must not be reset");
+
+    // a connection returned mid-transaction is rolled back
+    {
+      auto db = pool.get();
+      db.start_transaction();
+      db(std::string("INSERT INTO tab_reset (id) VALUES (1)"));
+    }
+    require(rollbacks == 1, "expected the open transaction to be rolled back");
+    {
+      auto db = pool.get();
+      require(sqlite3_get_autocommit(db.get()), "expected no open transaction");
+      require(count_rows(db.get()) == 0, "expected the insert to be rolled back");
+    }
+    require(rollbacks == 1, "clean connections must not be reset");
+
+    // without reset, the transaction leaks to the next user
+    config.reset_on_return = ::sqlpp::session_reset::none;
+    auto unsafe_pool = ::sqlpp::sqlite3::connection_pool_t<::sqlpp::debug::allowed>{options, config};
+    {
+      auto db = unsafe_pool.get();
+      db.start_transaction();
+    }
+    {
+      auto db = unsafe_pool.get();
+      require(not sqlite3_get_autocommit(db.get()), "expected the transaction to be left open");
+      db(std::string("ROLLBACK"));
+    }
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
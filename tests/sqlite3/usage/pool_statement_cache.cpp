@@ -0,0 +1,132 @@
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <atomic>
+#include <iostream>
+#include <optional>
+
+#include <sqlpp17/core/clause/select.h>
+#include <sqlpp17/core/parameter.h>
+
+#include <sqlpp17/sqlite3/connection_pool.h>
+#include <sqlpp17/sqlite3_test/get_config.h>
+
+#include <core_test/require.h>
+#include <core_test/tables/TabDepartment.h>
+
+using test::require;
+
+namespace
+{
+  SQLPP_CREATE_NAME_TAG(pId);
+
+  template <typename Connection>
+  auto select_name(Connection& db, std::int64_t id) -> void
+  {
+    using test::tabDepartment;
+    auto prepared_select = db.prepare(::sqlpp::select(tabDepartment.name)
+                                          .from(tabDepartment)
+                                          .where(tabDepartment.id == ::sqlpp::parameter<std::int64_t>(pId)));
+    prepared_select.parameters.pId = id;
+    auto result = execute(prepared_select);
+    require(not(result.begin() == result.end()), "expected a row");
+  }
+}  // namespace
+
+int main()
+{
+  try
+  {
+    auto config = ::sqlpp::sqlite3::test::get_config();
+    config.reset_on_return = ::sqlpp::session_reset::light;
+    auto options = ::sqlpp::connection_pool_options_t{};
+    options.max_size = 1;
+    auto pool = ::sqlpp::sqlite3::connection_pool_t<::sqlpp::debug::allowed>{options, config};
+
+    {
+      auto db = pool.get();
+      db(std::string("DROP TABLE IF EXISTS tab_department"));
+      db(std::string("CREATE TABLE tab_department (id INTEGER PRIMARY KEY, name TEXT, division TEXT)"));
+      db(std::string("INSERT INTO tab_department (id, name, division) VALUES (1, 'one', 'a'), (2, 'two', 'b')"));
+      select_name(db, 1);
+      require(db.statement_cache_stats().misses == 1, "expected the first prepare to miss");
+      require(db.statement_cache_stats().size == 1, "expected the statement to be cached");
+    }
+
+    // the statement cache is handed to the next user of the handle
+    {
+      auto db = pool.get();
+      select_name(db, 2);
+      const auto stats = db.statement_cache_stats();
+      require(stats.hits == 1, "expected prepare to hit the cache after a pool round trip");
+      require(stats.misses == 1, "expected no further misses");
+      require(stats.size == 1, "expected the statement to be returned to the cache");
+    }
+
+    // a statement that outlives its pooled connection does not return to the cache, which is used by the next
+    // connection object by then
+    {
+      auto db = std::optional{pool.get()};
+      auto prepared_select = db->prepare(::sqlpp::select(test::tabDepartment.division)
+                                             .from(test::tabDepartment)
+                                             .where(test::tabDepartment.id == ::sqlpp::parameter<std::int64_t>(pId)));
+      db.reset();
+
+      auto next = pool.get();
+      const auto size = next.statement_cache_stats().size;
+      {
+        const auto outliving = std::move(prepared_select);
+      }
+      require(next.statement_cache_stats().size == size, "expected the outliving statement to be finalized");
+      select_name(next, 1);
+    }
+
+    // statements outliving a connection that has been closed do not touch its cache
+    {
+      auto db = std::optional{::sqlpp::sqlite3::connection_t<::sqlpp::debug::allowed>{config}};
+      auto prepared_select = db->prepare(::sqlpp::select(test::tabDepartment.division)
+                                             .from(test::tabDepartment)
+                                             .where(test::tabDepartment.id == ::sqlpp::parameter<std::int64_t>(pId)));
+      db.reset();
+    }
+
+    // without a cache, every prepare is a miss
+    config.statement_cache_size = 0;
+    auto uncached_pool = ::sqlpp::sqlite3::connection_pool_t<::sqlpp::debug::allowed>{options, config};
+    {
+      auto db = uncached_pool.get();
+      select_name(db, 1);
+      select_name(db, 1);
+      require(db.statement_cache_stats().hits == 0, "expected no cache hits");
+      require(db.statement_cache_stats().size == 0, "expected nothing to be cached");
+    }
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
@@ -0,0 +1,103 @@
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <atomic>
+
+#include <iostream>
+
+#include <sqlpp17/core/clause/select.h>
+#include <sqlpp17/core/prefetching_result.h>
+#include <sqlpp17/core/transaction.h>
+
+#include <sqlpp17/sqlite3/connection.h>
+#include <sqlpp17/sqlite3_test/get_config.h>
+
+#include <core_test/require.h>
+#include <core_test/tables/TabDepartment.h>
+
+using test::require;
+
+int main()
+{
+  try
+  {
+    using test::tabDepartment;
+
+    auto config = ::sqlpp::sqlite3::test::get_config();
+    config.debug = nullptr;
+    auto db = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::none>{config};
+    db(std::string("DROP TABLE IF EXISTS tab_department"));
+    db(std::string("CREATE TABLE tab_department (id INTEGER PRIMARY KEY, name TEXT, division TEXT)"));
+
+    constexpr auto row_count = 10000;
+    {
+      auto tx = start_transaction(db);
+      for (auto i = 0; i < row_count; ++i)
+      {
+        db("INSERT INTO tab_department (id, name) VALUES (" + std::to_string(i) + ", 'name" + std::to_string(i) + "')");
+      }
+      tx.commit();
+    }
+
+    const auto statement = ::sqlpp::select(tabDepartment.id, tabDepartment.name).from(tabDepartment).unconditionally();
+
+    // All rows arrive in order, text fields stay valid while the next batch is fetched
+    {
+      auto result = ::sqlpp::prefetch(db(statement), 128);
+      auto expected_id = 0;
+      for (auto it = result.begin(); not(it == result.end()); ++it)
+      {
+        require(it->id == expected_id, "unexpected id");
+        require(std::string(it->name.value()) == "name" + std::to_string(expected_id), "unexpected name");
+        ++expected_id;
+      }
+      require(expected_id == row_count, "expected all rows");
+    }
+
+    // Batches that end exactly at the end of the result
+    {
+      auto result = ::sqlpp::prefetch(db(statement), row_count / 4);
+      auto count = 0;
+      for (auto it = result.begin(); not(it == result.end()); ++it)
+      {
+        ++count;
+      }
+      require(count == row_count, "expected all rows");
+    }
+
+    // Leaving early stops the background thread
+    {
+      auto result = ::sqlpp::prefetch(db(statement), 16);
+      require(not result.empty(), "expected rows");
+      require(result.begin()->id == 0, "expected the first row");
+    }
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
@@ -0,0 +1,188 @@
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+#include <sqlpp17/core/clause/insert_into.h>
+#include <sqlpp17/core/clause/select.h>
+#include <sqlpp17/core/routing_pool.h>
+#include <sqlpp17/core/transaction.h>
+
+#include <sqlpp17/sqlite3/connection_pool.h>
+#include <sqlpp17/sqlite3_test/get_config.h>
+
+#include <core_test/require.h>
+#include <core_test/tables/TabDepartment.h>
+
+using test::require;
+
+namespace
+{
+  using routing_pool_t = ::sqlpp::routing_pool_t<::sqlpp::sqlite3::connection_pool_t<::sqlpp::debug::none>>;
+
+  // Each database knows its name, so the result tells where a select was routed to
+  auto make_database(const std::string& name) -> ::sqlpp::sqlite3::connection_config_t
+  {
+    auto config = ::sqlpp::sqlite3::test::get_config();
+    config.path_to_database = "routing_" + name;
+    config.debug = nullptr;
+    auto db = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::none>{config};
+    db(std::string("DROP TABLE IF EXISTS tab_department"));
+    db(std::string("CREATE TABLE tab_department (id INTEGER PRIMARY KEY, name TEXT, division TEXT)"));
+    db(std::string("INSERT INTO tab_department (id, name, division) VALUES (1, '" + name + "', 'a')"));
+    return config;
+  }
+
+  template <typename Connection>
+  auto routed_to(Connection& db) -> std::string
+  {
+    using test::tabDepartment;
+    auto result = db(::sqlpp::select(tabDepartment.name).from(tabDepartment).where(tabDepartment.id == 1));
+    return std::string(result.front().name.value());
+  }
+
+  auto make_pool(::sqlpp::routing_pool_options_t options,
+                 std::vector<::sqlpp::sqlite3::connection_config_t> replicas) -> std::unique_ptr<routing_pool_t>
+  {
+    return std::make_unique<routing_pool_t>(options, ::sqlpp::connection_pool_options_t{}, make_database("primary"),
+                                            std::move(replicas));
+  }
+}  // namespace
+
+int main()
+{
+  try
+  {
+    using test::tabDepartment;
+
+    // round robin
+    {
+      auto pool = make_pool({}, {make_database("replica_1"), make_database("replica_2")});
+      auto first = pool->get();
+      auto second = pool->get();
+      require(routed_to(first) == "replica_1", "expected the first replica");
+      require(routed_to(second) == "replica_2", "expected the second replica");
+      require(routed_to(first) == "replica_1", "expected the routing connection to keep its replica");
+
+      // writes and reads within transactions go to the primary
+      first(::sqlpp::insert_into(tabDepartment).set(tabDepartment.name = "written"));
+      require(routed_to(first.primary()) == "primary", "expected the primary");
+      auto transaction = ::sqlpp::start_transaction(first);
+      require(routed_to(first) == "primary", "expected reads within transactions to go to the primary");
+      transaction.commit();
+      require(routed_to(first) == "replica_1", "expected reads to go to the replica again");
+    }
+
+    // least loaded
+    {
+      auto options = ::sqlpp::routing_pool_options_t{};
+      options.selection = ::sqlpp::replica_selection::least_loaded;
+      auto pool = make_pool(options, {make_database("replica_1"), make_database("replica_2")});
+      auto first = pool->get();
+      require(routed_to(first) == "replica_1", "expected the first replica");
+      auto second = pool->get();
+      require(routed_to(second) == "replica_2", "expected the unused replica");
+      require(pool->replica_status()[0].in_use == 1, "expected one connection in use");
+    }
+
+    // read your writes
+    {
+      auto options = ::sqlpp::routing_pool_options_t{};
+      options.read_your_writes = std::chrono::seconds{60};
+      auto pool = make_pool(options, {make_database("replica_1")});
+      {
+        auto db = pool->get();
+        require(routed_to(db) == "replica_1", "expected the replica before any write");
+      }
+      auto db = pool->get();
+      db(::sqlpp::insert_into(tabDepartment).set(tabDepartment.name = "written"));
+      require(routed_to(db) == "primary", "expected reads to go to the primary after a write");
+      auto other = pool->get();
+      require(routed_to(other) == "primary", "expected the window to apply to the pool");
+    }
+
+    // replica health
+    {
+      auto unreachable = ::sqlpp::sqlite3::test::get_config();
+      unreachable.path_to_database = "routing_does_not_exist";
+      unreachable.flags = SQLITE_OPEN_READWRITE;
+      unreachable.debug = nullptr;
+      auto pool = make_pool({}, {unreachable, make_database("replica_2")});
+      for (auto i = 0; i < 3; ++i)
+      {
+        auto db = pool->get();
+        require(routed_to(db) == "replica_2", "expected the healthy replica");
+      }
+      const auto status = pool->replica_status();
+      require(not status[0].healthy and status[0].failures == 1, "expected the unreachable replica to be down");
+      require(status[1].healthy and status[1].reads == 3, "expected the healthy replica to serve all reads");
+
+      pool->mark_replica_down(1);
+      auto db = pool->get();
+      require(routed_to(db) == "primary", "expected reads to go to the primary without healthy replicas");
+    }
+
+    // a replica that hands out connections but fails every statement
+    {
+      auto broken = ::sqlpp::sqlite3::test::get_config();
+      broken.path_to_database = "routing_not_a_database";
+      broken.debug = nullptr;
+      std::ofstream{broken.path_to_database} << "this is not a database file, statements fail with SQLITE_NOTADB";
+
+      auto options = ::sqlpp::routing_pool_options_t{};
+      options.replica_retry_after = std::chrono::milliseconds{50};
+      auto pool = make_pool(options, {broken, make_database("replica_2")});
+      {
+        auto db = pool->get();
+        require(routed_to(db) == "replica_2", "expected the failed read to move on to the healthy replica");
+        require(routed_to(db) == "replica_2", "expected the routing connection to keep the healthy replica");
+      }
+      const auto status = pool->replica_status();
+      require(not status[0].healthy and status[0].failures == 1, "expected the broken replica to be down");
+
+      // consecutive failures double the time a replica is skipped
+      std::this_thread::sleep_for(std::chrono::milliseconds{60});
+      {
+        auto db = pool->get();
+        require(routed_to(db) == "replica_2", "expected the broken replica to fail again");
+      }
+      require(pool->replica_status()[0].failures == 2, "expected a second failure");
+      std::this_thread::sleep_for(std::chrono::milliseconds{60});
+      require(not pool->replica_status()[0].healthy, "expected a longer backoff after the second failure");
+      std::remove(broken.path_to_database.c_str());
+    }
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
@@ -0,0 +1,99 @@
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <atomic>
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+#include <sqlpp17/core/clause/insert_into.h>
+#include <sqlpp17/core/run_in_transaction.h>
+
+#include <sqlpp17/sqlite3/connection.h>
+#include <sqlpp17/sqlite3_test/get_config.h>
+
+#include <core_test/require.h>
+#include <core_test/tables/TabDepartment.h>
+
+using test::require;
+
+namespace
+{
+  using connection_t = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::none>;
+}  // namespace
+
+int main()
+{
+  try
+  {
+    using test::tabDepartment;
+
+    auto config = ::sqlpp::sqlite3::test::get_config();
+    config.path_to_database = "run_in_transaction";
+    config.debug = nullptr;
+    auto db = connection_t{config};
+    db(std::string("DROP TABLE IF EXISTS tab_department"));
+    db(std::string("CREATE TABLE tab_department (id INTEGER PRIMARY KEY, name TEXT, division TEXT)"));
+
+    // Another connection holds the write lock, writes fail with SQLITE_BUSY
+    auto other = connection_t{config};
+    other(std::string("BEGIN IMMEDIATE"));
+    try
+    {
+      db(::sqlpp::insert_into(tabDepartment).set(tabDepartment.name = "blocked"));
+      require(false, "expected the write to fail");
+    }
+    catch (const ::sqlpp::database_exception& e)
+    {
+      require(e.code() == ::sqlpp::error_code::busy, "expected SQLITE_BUSY to be classified as busy");
+      require(::sqlpp::is_retryable(e.code()), "expected SQLITE_BUSY to be retryable");
+    }
+
+    // run_in_transaction retries until the lock is released
+    auto release = std::thread([&other]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds{50});
+      other(std::string("COMMIT"));
+    });
+    auto policy = ::sqlpp::retry_policy_t{};
+    policy.max_attempts = 50;
+    auto attempts = 0;
+    ::sqlpp::run_in_transaction(
+        db,
+        [&attempts](connection_t& connection) {
+          ++attempts;
+          connection(::sqlpp::insert_into(tabDepartment).set(tabDepartment.name = "retried"));
+        },
+        policy);
+    release.join();
+    require(attempts > 1, "expected the transaction to be retried");
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
@@ -0,0 +1,161 @@
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <atomic>
+
+#include <iostream>
+
+#include <sqlpp17/core/clause/insert_into.h>
+#include <sqlpp17/core/clause/select.h>
+#include <sqlpp17/core/sharded_connection.h>
+
+#include <sqlpp17/sqlite3/connection.h>
+#include <sqlpp17/sqlite3_test/get_config.h>
+
+#include <core_test/require.h>
+#include <core_test/tables/TabDepartment.h>
+
+using test::require;
+
+namespace
+{
+  using connection_t = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::none>;
+
+  auto make_shards(std::size_t count) -> std::vector<connection_t>
+  {
+    auto shards = std::vector<connection_t>{};
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      auto config = ::sqlpp::sqlite3::test::get_config();
+      config.path_to_database = "sharded_" + std::to_string(i);
+      config.debug = nullptr;
+      shards.emplace_back(config);
+    }
+    return shards;
+  }
+
+  template <typename Result>
+  auto ids_of(Result&& result) -> std::vector<int64_t>
+  {
+    auto ids = std::vector<int64_t>{};
+    for (auto it = result.begin(); not(it == result.end()); ++it)
+    {
+      ids.push_back(it->id);
+    }
+    return ids;
+  }
+}  // namespace
+
+int main()
+{
+  try
+  {
+    using test::tabDepartment;
+
+    auto db = ::sqlpp::sharded_connection_t<connection_t, int64_t>{
+        make_shards(3), [](const int64_t& id) { return static_cast<std::size_t>(id); }};
+    require(db.shard_count() == 3, "expected three shards");
+
+    for (std::size_t i = 0; i < db.shard_count(); ++i)
+    {
+      db.shard(i)(std::string("DROP TABLE IF EXISTS tab_department"));
+      db.shard(i)(std::string("CREATE TABLE tab_department (id INTEGER PRIMARY KEY, name TEXT, division TEXT)"));
+    }
+    for (int64_t id = 1; id <= 10; ++id)
+    {
+      db.shard_for(id)(std::string("INSERT INTO tab_department (id, name) VALUES (" + std::to_string(id) + ", 'd" +
+                                   std::to_string(id) + "')"));
+    }
+
+    // point reads go to a single shard
+    {
+      const auto point_read = ::sqlpp::select(tabDepartment.name).from(tabDepartment).where(tabDepartment.id == 4);
+      auto result = db(int64_t{4}, point_read);
+      require(std::string(result.front().name.value()) == "d4", "expected the row of the shard key");
+      auto other = db(int64_t{5}, point_read);
+      require(other.empty(), "expected another shard not to have the row");
+    }
+
+    // ordered fan out is merged in order
+    {
+      const auto ids = ids_of(db(::sqlpp::select(tabDepartment.id, tabDepartment.name)
+                                     .from(tabDepartment)
+                                     .unconditionally()
+                                     .order_by(desc(tabDepartment.id))));
+      require(ids == std::vector<int64_t>{10, 9, 8, 7, 6, 5, 4, 3, 2, 1}, "expected the merged rows in order");
+    }
+
+    // limit stops the merge early
+    {
+      const auto ids = ids_of(db(::sqlpp::select(tabDepartment.id)
+                                     .from(tabDepartment)
+                                     .where(tabDepartment.id > 2)
+                                     .order_by(asc(tabDepartment.id))
+                                     .limit(4)));
+      require(ids == std::vector<int64_t>{3, 4, 5, 6}, "expected the first four rows");
+    }
+
+    // unordered fan out is concatenated in shard order
+    {
+      const auto ids = ids_of(db(::sqlpp::select(tabDepartment.id).from(tabDepartment).unconditionally()));
+      require(ids == std::vector<int64_t>{3, 6, 9, 1, 4, 7, 10, 2, 5, 8}, "expected the rows in shard order");
+    }
+
+    // writes with a shard key go to a single shard
+    db(int64_t{2}, ::sqlpp::insert_into(tabDepartment).set(tabDepartment.name = "written"));
+    {
+      const auto ids =
+          ids_of(db(::sqlpp::select(tabDepartment.id).from(tabDepartment).where(tabDepartment.name == "written")));
+      require(ids.size() == 1, "expected the write on one shard only");
+      auto result = db(int64_t{2},
+                       ::sqlpp::select(tabDepartment.id).from(tabDepartment).where(tabDepartment.name == "written"));
+      require(not result.empty(), "expected the write on the shard of the key");
+    }
+
+    // statements with a value for the key column carry their shard key
+    {
+      auto keyed = ::sqlpp::sharded_connection_t<connection_t, std::string, decltype(tabDepartment.division)>{
+          make_shards(3), [](const std::string& division) { return division.size(); }};
+      keyed(::sqlpp::insert_into(tabDepartment).set(tabDepartment.name = "keyed", tabDepartment.division = "ab"));
+      const auto point_read =
+          ::sqlpp::select(tabDepartment.id).from(tabDepartment).where(tabDepartment.division == "ab");
+      require(not db.shard(2)(point_read).empty(), "expected the insert on the shard of its key");
+      require(db.shard(0)(point_read).empty(), "expected the insert on one shard only");
+
+      const auto keyed_read = ::sqlpp::select(tabDepartment.id)
+                                  .from(tabDepartment)
+                                  .where(tabDepartment.name == "keyed" and tabDepartment.division == "ab");
+      static_assert(std::is_same_v<decltype(keyed(keyed_read)), decltype(keyed.shard(0)(keyed_read))>,
+                    "expected the point read on a single shard");
+      require(ids_of(keyed(keyed_read)).size() == 1, "expected the point read on the shard of its key");
+    }
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
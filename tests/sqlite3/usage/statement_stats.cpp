@@ -0,0 +1,131 @@
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <iostream>
+
+#include <sqlpp17/core/clause/select.h>
+#include <sqlpp17/core/parameter.h>
+
+#include <sqlpp17/sqlite3/connection.h>
+#include <sqlpp17/sqlite3_test/get_config.h>
+
+#include <core_test/require.h>
+#include <core_test/tables/TabDepartment.h>
+
+using test::require;
+
+namespace
+{
+  SQLPP_CREATE_NAME_TAG(pDivision);
+
+  template <typename Result>
+  auto drain(Result& result) -> void
+  {
+    for (auto it = result.begin(); not(it == result.end()); ++it)
+    {
+    }
+  }
+}  // namespace
+
+int main()
+{
+  try
+  {
+    auto config = ::sqlpp::sqlite3::test::get_config();
+    config.collect_statement_stats = true;
+    auto db = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::allowed>{config};
+
+    db(std::string("DROP TABLE IF EXISTS tab_department"));
+    db(std::string("CREATE TABLE tab_department (id INTEGER PRIMARY KEY, name TEXT, division TEXT)"));
+    db(std::string("WITH RECURSIVE c(x) AS (SELECT 1 UNION ALL SELECT x + 1 FROM c WHERE x < 200) "
+                   "INSERT INTO tab_department (id, name, division) SELECT x, 'name' || (x % 50), 'div' || (x % 10) "
+                   "FROM c"));
+
+    using test::tabDepartment;
+
+    // lookup by primary key
+    {
+      auto result = db(::sqlpp::select(tabDepartment.name).from(tabDepartment).where(tabDepartment.id == 17));
+      drain(result);
+    }
+    require(db.last_statement_stats().fullscan_steps == 0, "primary key lookup should not scan");
+    require(db.last_statement_stats().vm_steps > 0, "expected vm steps to be counted");
+
+    // lookup by an unindexed column, prepared
+    auto prepared_select = db.prepare(::sqlpp::select(tabDepartment.name)
+                                          .from(tabDepartment)
+                                          .where(tabDepartment.division == ::sqlpp::parameter<std::string>(pDivision)));
+    prepared_select.parameters.pDivision = "div3";
+    {
+      auto result = execute(prepared_select);
+      drain(result);
+    }
+    require(db.last_statement_stats().fullscan_steps > 0, "expected a full scan without index");
+    require(prepared_select.stats().fullscan_steps > 0, "expected a full scan without index");
+
+    db(std::string("CREATE INDEX tab_department_division ON tab_department (division)"));
+    prepared_select = db.prepare(::sqlpp::select(tabDepartment.name)
+                                     .from(tabDepartment)
+                                     .where(tabDepartment.division == ::sqlpp::parameter<std::string>(pDivision)));
+    prepared_select.parameters.pDivision = "div3";
+    {
+      auto result = execute(prepared_select);
+      drain(result);
+    }
+    require(prepared_select.stats(true).fullscan_steps == 0, "expected no full scan with index");
+    require(prepared_select.stats().vm_steps == 0, "expected counters to be reset");
+
+    // automatic index for an unindexed join
+    const auto join = std::string("SELECT count(*) FROM tab_department a, tab_department b WHERE a.name = b.name");
+    db(join);
+    require(db.last_statement_stats().autoindexes > 0, "expected an automatic index");
+    db(std::string("CREATE INDEX tab_department_name ON tab_department (name)"));
+    db(join);
+    require(db.last_statement_stats().autoindexes == 0, "expected no automatic index");
+
+    // page cache
+    const auto cache = db.cache_stats(true);
+    require(cache.hits + cache.misses > 0, "expected page cache activity");
+    require(db.cache_stats().hits == 0, "expected cache counters to be reset");
+
+    // stats are opt-in
+    config.collect_statement_stats = false;
+    auto db2 = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::allowed>{config};
+    try
+    {
+      [[maybe_unused]] const auto stats = db2.last_statement_stats();
+      throw std::runtime_error("Expected statement stats to be disabled");
+    }
+    catch (const ::sqlpp::exception&)
+    {
+    }
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
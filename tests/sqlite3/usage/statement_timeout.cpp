@@ -0,0 +1,136 @@
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+#include <sqlpp17/core/clause/select.h>
+#include <sqlpp17/core/statement_timeout.h>
+
+#include <sqlpp17/sqlite3/connection.h>
+#include <sqlpp17/sqlite3_test/get_config.h>
+
+#include <core_test/tables/TabDepartment.h>
+
+namespace
+{
+  const auto endless_query =
+      std::string{"WITH RECURSIVE c(x) AS (SELECT 1 UNION ALL SELECT x + 1 FROM c) SELECT count(*) FROM c"};
+
+  template <typename Db>
+  auto expect_cancelled(Db& db) -> void
+  {
+    try
+    {
+      db(endless_query);
+    }
+    catch (const ::sqlpp::cancelled_exception&)
+    {
+      return;
+    }
+    throw std::runtime_error("Expected statement to be cancelled");
+  }
+}  // namespace
+
+int main()
+{
+  try
+  {
+    using namespace std::chrono_literals;
+
+    auto config = ::sqlpp::sqlite3::test::get_config();
+    auto db = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::allowed>{config};
+
+    // scoped timeout
+    {
+      const auto timeout = ::sqlpp::scoped_statement_timeout{db, 50ms};
+      expect_cancelled(db);
+    }
+    if (db.get_statement_timeout() != 0ms)
+      throw std::runtime_error("Expected statement timeout to be restored");
+
+    // the connection can be used after a statement was cancelled
+    db(std::string("SELECT 1"));
+
+    // cancel from another thread
+    {
+      auto done = std::atomic<bool>{false};
+      auto canceller = std::thread{[handle = db.cancel_handle(), &done]() {
+        while (not done)
+        {
+          std::this_thread::sleep_for(10ms);
+          handle.cancel();
+        }
+      }};
+      try
+      {
+        expect_cancelled(db);
+      }
+      catch (...)
+      {
+        done = true;
+        canceller.join();
+        throw;
+      }
+      done = true;
+      canceller.join();
+    }
+
+    // timeout via config
+    config.statement_timeout = 50ms;
+    auto db2 = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::allowed>{config};
+    expect_cancelled(db2);
+
+    // time spent processing rows does not count
+    {
+      // Every step has to scan 5000 rows, enough to reach the progress handler
+      db2.set_statement_timeout(0ms);
+      db2(std::string("DROP TABLE IF EXISTS tab_department"));
+      db2(std::string("CREATE TABLE tab_department (id INTEGER PRIMARY KEY, name TEXT, division TEXT)"));
+      db2(std::string("INSERT INTO tab_department (id, division) WITH RECURSIVE c(x) AS (SELECT 1 UNION ALL SELECT x + 1 "
+                      "FROM c WHERE x < 50000) SELECT x, CASE WHEN x % 5000 = 0 THEN 'slow' ELSE 'fast' END FROM c"));
+      db2.set_statement_timeout(50ms);
+      auto result = db2(::sqlpp::select(test::tabDepartment.id)
+                            .from(test::tabDepartment)
+                            .where(test::tabDepartment.division == std::string("slow")));
+      auto rows = 0;
+      for (auto it = result.begin(); not(it == result.end()); ++it)
+      {
+        std::this_thread::sleep_for(10ms);
+        ++rows;
+      }
+      if (rows != 10)
+        throw std::runtime_error("Expected slowly processed rows not to be cancelled");
+    }
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
@@ -26,11 +26,16 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <iostream>
 
+#include <sqlpp17/core/exception.h>
 #include <sqlpp17/core/transaction.h>
 
 #include <sqlpp17/sqlite3/connection.h>
 #include <sqlpp17/sqlite3_test/get_config.h>
 
+#include <core_test/require.h>
+
+using test::require;
+
 int main()
 {
   try
@@ -58,6 +63,63 @@ int main()
       // ...
       // tx' destructor will auto-rollback the transaction
     }
+
+    // write lock at the start
+    {
+      auto options = ::sqlpp::transaction_options_t{};
+      options.lock = ::sqlpp::transaction_lock::immediate;
+      auto tx = start_transaction(db, options);
+      // ...
+      tx.commit();
+    }
+
+    // BEGIN is sent with the first statement
+    {
+      auto options = ::sqlpp::transaction_options_t{};
+      options.lazy = true;
+      auto tx = start_transaction(db, options);
+      require(sqlite3_get_autocommit(db.get()), "expected no BEGIN before the first statement");
+      db(std::string("SELECT 1"));
+      require(not sqlite3_get_autocommit(db.get()), "expected BEGIN with the first statement");
+      tx.commit();
+      require(sqlite3_get_autocommit(db.get()), "expected COMMIT");
+    }
+
+    // no statements, no BEGIN and COMMIT
+    {
+      auto options = ::sqlpp::transaction_options_t{};
+      options.lazy = true;
+      auto tx = start_transaction(db, options);
+      tx.commit();
+      require(sqlite3_get_autocommit(db.get()), "expected no open transaction");
+    }
+
+    // a failed BEGIN is sent again with the next statement
+    {
+      auto writer = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::allowed>{config};
+      writer(std::string("BEGIN IMMEDIATE TRANSACTION"));
+
+      auto options = ::sqlpp::transaction_options_t{};
+      options.lazy = true;
+      options.lock = ::sqlpp::transaction_lock::immediate;
+      auto tx = start_transaction(db, options);
+      auto failed = false;
+      try
+      {
+        db(std::string("SELECT 1"));
+      }
+      catch (const ::sqlpp::exception&)
+      {
+        failed = true;
+      }
+      require(failed, "expected BEGIN IMMEDIATE to fail while another connection writes");
+
+      writer(std::string("COMMIT"));
+      db(std::string("SELECT 1"));
+      require(not sqlite3_get_autocommit(db.get()), "expected BEGIN with the next statement");
+      tx.commit();
+      require(sqlite3_get_autocommit(db.get()), "expected COMMIT");
+    }
   }
   catch (const std::exception& e)
   {
@@ -0,0 +1,157 @@
+/*
+Copyright (c) 2026, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <sqlpp17/core/clause/select.h>
+#include <sqlpp17/core/clause/from.h>
+#include <sqlpp17/core/clause/order_by.h>
+#include <sqlpp17/core/clause/where.h>
+
+#include <sqlpp17/sqlite3/connection.h>
+#include <sqlpp17/sqlite3/context.h>
+#include <sqlpp17/sqlite3/virtual_table.h>
+#include <sqlpp17/sqlite3_test/get_config.h>
+
+#include <core_test/tables/TabDepartment.h>
+#include <core_test/tables/TabPerson.h>
+
+namespace
+{
+  struct person
+  {
+    std::int64_t id;
+    bool isManager;
+    std::string name;
+    std::optional<std::string> address;
+    std::string language;
+  };
+
+  // The details of the query plan, one line per step
+  template <typename Db, typename Statement>
+  auto query_plan(Db& db, const Statement& statement) -> std::string
+  {
+    auto context = ::sqlpp::sqlite3::context_t{};
+    const auto sql = "EXPLAIN QUERY PLAN " + to_sql_string(context, statement);
+    ::sqlite3_stmt* handle = nullptr;
+    if (sqlite3_prepare_v2(db.get(), sql.c_str(), -1, &handle, nullptr) != SQLITE_OK)
+      throw std::runtime_error("Could not explain " + sql);
+    auto plan = std::string{};
+    while (sqlite3_step(handle) == SQLITE_ROW)
+    {
+      plan += reinterpret_cast<const char*>(sqlite3_column_text(handle, 3));
+      plan += "\n";
+    }
+    sqlite3_finalize(handle);
+    return plan;
+  }
+}  // namespace
+
+int main()
+{
+  try
+  {
+    const auto config = ::sqlpp::sqlite3::test::get_config();
+    auto db = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::allowed>{config};
+
+    const auto persons = std::vector<person>{{17, true, "Anna", std::nullopt, "C++"},
+                                             {3, false, "Bert", "Main Street 1", "C"},
+                                             {42, false, "Carl", std::nullopt, "C++"}};
+
+    db(std::string("DROP TABLE IF EXISTS tab_department"));
+    db(std::string("CREATE TABLE tab_department (id INTEGER PRIMARY KEY, name TEXT, division TEXT)"));
+    db(std::string("INSERT INTO tab_department (id, name, division) VALUES (3, 'Compilers', 'C'), "
+                   "(17, 'Libraries', 'C++'), (99, 'Unused', 'none')"));
+
+    {
+      const auto table = ::sqlpp::sqlite3::register_container_table(db, test::tabPerson, persons);
+
+      // full scan
+      auto count = 0;
+      const auto scan = ::sqlpp::select(test::tabPerson.id, test::tabPerson.name, test::tabPerson.address)
+                            .from(test::tabPerson)
+                            .where(test::tabPerson.isManager == false);
+      if (query_plan(db, scan).find("VIRTUAL TABLE INDEX 0:") == std::string::npos)
+        throw std::runtime_error("Expected a full scan, got " + query_plan(db, scan));
+      auto result = db(scan);
+      for (auto it = result.begin(); !(it == result.end()); ++it)
+      {
+        ++count;
+      }
+      if (count != 2)
+        throw std::runtime_error("Expected 2 rows, got " + std::to_string(count));
+
+      // key lookup
+      const auto key_lookup = ::sqlpp::select(test::tabPerson.name, test::tabPerson.address)
+                                  .from(test::tabPerson)
+                                  .where(test::tabPerson.id == 3);
+      // idxNum 1 is the key path of xBestIndex/xFilter
+      if (query_plan(db, key_lookup).find("VIRTUAL TABLE INDEX 1:") == std::string::npos)
+        throw std::runtime_error("Expected a key lookup, got " + query_plan(db, key_lookup));
+      auto lookup = db(key_lookup);
+      const auto& row = lookup.front();
+      if (row.name != "Bert" or not row.address or *row.address != "Main Street 1")
+        throw std::runtime_error("Unexpected result for key lookup");
+
+      // join with a regular table
+      auto joined = db(::sqlpp::select(test::tabPerson.name, test::tabDepartment.division)
+                           .from(test::tabPerson.join(test::tabDepartment)
+                                     .on(test::tabPerson.id == test::tabDepartment.id))
+                           .where(test::tabDepartment.division == test::tabPerson.language)
+                           .order_by(::sqlpp::asc(test::tabPerson.name)));
+      auto matches = std::vector<std::string>{};
+      for (auto it = joined.begin(); !(it == joined.end()); ++it)
+      {
+        matches.push_back(std::string(it->name) + "/" + std::string(it->division));
+      }
+      if (matches.size() != 2 or matches[0] != "Anna/C++" or matches[1] != "Bert/C")
+      {
+        auto found = std::string{};
+        for (const auto& match : matches)
+          found += " " + match;
+        throw std::runtime_error("Unexpected join result:" + found);
+      }
+    }
+
+    // the table is gone with the registration
+    try
+    {
+      db(::sqlpp::select(test::tabPerson.id).from(test::tabPerson).unconditionally());
+      throw std::logic_error("Expected the container table to be unregistered");
+    }
+    catch (const ::sqlpp::exception&)
+    {
+    }
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}